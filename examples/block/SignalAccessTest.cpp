@@ -0,0 +1,96 @@
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <unistd.h>
+
+#include <eeros/logger/Logger.hpp>
+#include <eeros/logger/StreamLogWriter.hpp>
+#include <eeros/control/TimeDomain.hpp>
+#include <eeros/control/Constant.hpp>
+#include <eeros/control/Gain.hpp>
+#include <eeros/control/Sum.hpp>
+#include <eeros/core/System.hpp>
+#include <eeros/core/Statistics.hpp>
+
+using namespace eeros;
+using namespace eeros::control;
+namespace {
+  using Logger = eeros::logger::Logger;
+}
+
+int blocks = 200;
+int loops = 10000;
+
+// runs the time domain repeatedly and measures the duration of a cycle
+Statistics measure(TimeDomain &td) {
+  Statistics cycle;
+  for (int i = 0; i < 100; i++) td.run();   // warm up caches
+  for (int i = 0; i < loops; i++) {
+    uint64_t start = System::getTimeNs();
+    td.run();
+    cycle.add((System::getTimeNs() - start) * 1e-9);
+  }
+  return cycle;
+}
+
+void report(Logger &log, std::string name, Statistics &s) {
+  log.info() << name << ": mean " << s.mean * 1e6 << " us   min " << s.min * 1e6
+             << " us   max " << s.max * 1e6 << " us   (" << s.mean * 1e9 / blocks << " ns per block)";
+}
+
+int main(int argc, char *argv[]) {
+  int c;
+  while((c = getopt(argc, argv, "b:n:")) != -1) {
+    switch (c) {
+    case 'b':
+      blocks = atoi(optarg);
+      break;
+    case 'n':
+      loops = atoi(optarg);
+      break;
+    default:
+      std::cout << "usage: " << argv[0] << " [-b blocks] [-n loops]" << std::endl;
+      return 1;
+    }
+  }
+  Logger::setDefaultStreamLogger(std::cout);
+  Logger log = Logger::getLogger();
+  log.info() << "Signal access test: " << blocks << " blocks, " << loops << " cycles";
+
+  // a chain of gains and sums, every sum reads the two preceding blocks
+  TimeDomain td("td", 0.001, false);
+  Constant<> c0(1.0);
+  td.addBlock(c0);
+  std::vector<std::unique_ptr<Block>> chain;
+  Output<>* prev = &c0.getOut();
+  Output<>* prevprev = &c0.getOut();
+  for (int i = 0; i < blocks; i++) {
+    Output<>* out;
+    if (i % 2 == 0) {
+      auto g = new Gain<>(1.0);
+      g->getIn().connect(*prev);
+      out = &g->getOut();
+      chain.emplace_back(g);
+    } else {
+      auto s = new Sum<2>();
+      s->getIn(0).connect(*prev);
+      s->getIn(1).connect(*prevprev);
+      s->negateInput(1);
+      out = &s->getOut();
+      chain.emplace_back(s);
+    }
+    td.addBlock(chain.back().get());
+    prevprev = prev;
+    prev = out;
+  }
+  td.sortBlocks();
+  td.start();
+
+  Statistics unfrozen = measure(td);
+  report(log, "virtual", unfrozen);
+  if (!td.freeze()) log.warn() << "not all inputs could be frozen";
+  Statistics frozen = measure(td);
+  report(log, "frozen ", frozen);
+  log.info() << "speedup: " << unfrozen.mean / frozen.mean;
+  return 0;
+}
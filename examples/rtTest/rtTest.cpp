@@ -5,12 +5,14 @@
 #include <thread>
 #include <ctime>
 #include <iomanip>
+#include <fstream>
 
 #include <eeros/logger/Logger.hpp>
 #include <eeros/logger/LogWriter.hpp>
 #include <eeros/logger/StreamLogWriter.hpp>
 #include <eeros/core/Version.hpp>
 #include <eeros/core/Executor.hpp>
+#include <eeros/core/Tracer.hpp>
 #include <eeros/task/Periodic.hpp>
 #include <eeros/control/TimeDomain.hpp>
 #include <eeros/safety/SafetyProperties.hpp>
@@ -34,16 +36,32 @@ class SafetyPropertiesTest : public SafetyProperties {
 };
 
 int seconds = 10;
+int busyWait = 0;  // us
+int cpu = -1;
+std::string histogramFile;
+std::string traceFile;
 
 int main(int argc, char *argv[]) {
   int c;
-  while((c = getopt(argc, argv, "s:")) != -1) {
+  while((c = getopt(argc, argv, "s:b:c:o:t:")) != -1) {
     switch (c) {
     case 's':
       seconds = atoi(optarg);
       break;
+    case 'b':
+      busyWait = atoi(optarg);
+      break;
+    case 'c':
+      cpu = atoi(optarg);
+      break;
+    case 'o':
+      histogramFile = optarg;
+      break;
+    case 't':
+      traceFile = optarg;
+      break;
     case '?':
-      if (optopt == 's')
+      if (optopt == 's' || optopt == 'b' || optopt == 'c' || optopt == 'o' || optopt == 't')
         std::cerr << "Option " << char(optopt) << " requires an argument.\n" << std::endl;
       else if (isprint (optopt))
         std::cerr << "Unknown option " << char(optopt) << std::endl;
@@ -70,13 +88,27 @@ int main(int argc, char *argv[]) {
   auto& executor = eeros::Executor::instance();
   eeros::task::Periodic per("per", dt, ss);
   executor.setMainTask(per);
+  executor.setBusyWaitTime(busyWait * 1e-6);
+  if (cpu >= 0) executor.setAffinity({cpu});
   per.monitors.push_back([&](eeros::PeriodicCounter &c, Logger &log){
     static int ticks = 0;
-    if (++ticks % 1000 == 0) log.info() << "ss: period max: " << c.period.max << "   period min: " << c.period.min << "   period mean: " << c.period.mean;
+    if (++ticks % 1000 == 0) log.info() << "ss: period max: " << c.period.max << "   period min: " << c.period.min << "   period mean: " << c.period.mean << "   missed: " << c.missedDeadlines;
     if (ticks > seconds / dt) executor.stop();
   });
 
+  if (!traceFile.empty()) Tracer::instance().start(traceFile);
   executor.run();
+  if (!traceFile.empty()) {
+    Tracer::instance().stop();
+    log.info() << "trace written to " << traceFile << ", " << Tracer::instance().getDropped() << " events dropped";
+  }
+
+  executor.counter >> log.info();
+  if (!histogramFile.empty()) {
+    std::ofstream file(histogramFile);
+    executor.counter.dumpHistograms(file);
+    log.info() << "histograms written to " << histogramFile;
+  }
 
   return 0;
 }
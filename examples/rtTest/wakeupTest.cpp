@@ -0,0 +1,93 @@
+#include <iostream>
+#include <atomic>
+#include <thread>
+#include <unistd.h>
+
+#include <eeros/logger/Logger.hpp>
+#include <eeros/logger/StreamLogWriter.hpp>
+#include <eeros/core/Executor.hpp>
+#include <eeros/core/System.hpp>
+#include <eeros/core/Statistics.hpp>
+#include <eeros/core/Semaphore.hpp>
+#include <eeros/core/FutexSemaphore.hpp>
+
+using namespace eeros;
+namespace {
+  using Logger = eeros::logger::Logger;
+}
+
+int loops = 10000;
+bool realtime = false;
+
+// measures the time from posting a semaphore until the waiting thread runs
+template < typename S >
+Statistics measure() {
+  S semaphore;
+  Statistics latency;
+  std::atomic<uint64_t> postTime(0);
+  std::atomic<bool> done(false);
+  std::thread waiter([&]() {
+    if (realtime) Executor::set_priority(1);
+    semaphore.wait();
+    while (!done) {
+      latency.add((System::getTimeNs() - postTime) * 1e-9);
+      semaphore.wait();
+    }
+  });
+  usleep(100000);   // let the waiter block
+  for (int i = 0; i < loops; i++) {
+    postTime = System::getTimeNs();
+    semaphore.post();
+    usleep(500);
+  }
+  done = true;
+  semaphore.post();
+  waiter.join();
+  return latency;
+}
+
+void report(Logger &log, std::string name, Statistics &s) {
+  log.info() << name << ": mean " << s.mean * 1e6 << " us   min " << s.min * 1e6 
+             << " us   max " << s.max * 1e6 << " us   (" << s.count << " wakeups)";
+}
+
+int main(int argc, char *argv[]) {
+  int c;
+  while((c = getopt(argc, argv, "n:r")) != -1) {
+    switch (c) {
+    case 'n':
+      loops = atoi(optarg);
+      break;
+    case 'r':
+      realtime = true;
+      break;
+    case '?':
+      if (optopt == 'n')
+        std::cerr << "Option " << char(optopt) << " requires an argument.\n" << std::endl;
+      else if (isprint (optopt))
+        std::cerr << "Unknown option " << char(optopt) << std::endl;
+      else
+        std::cerr << "Unknown option character " << char(optopt) << std::endl;
+      return -1;
+      break;
+     default:
+       abort ();
+    }
+  }
+
+  Logger::setDefaultStreamLogger(std::cout);
+  Logger log = Logger::getLogger('M');
+
+  log.info() << "measure post to run latency of " << loops << " wakeups" << (realtime ? " with realtime priority" : "");
+  if (realtime) {
+    if (!Executor::set_priority(0)) log.error() << "could not set realtime priority";
+    if (!Executor::lock_memory()) log.error() << "could not lock memory in RAM";
+  }
+
+  auto mutexLatency = measure<Semaphore>();
+  report(log, "Semaphore     ", mutexLatency);
+  auto futexLatency = measure<FutexSemaphore>();
+  report(log, "FutexSemaphore", futexLatency);
+
+  return 0;
+}
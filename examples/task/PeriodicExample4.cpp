@@ -0,0 +1,63 @@
+#include <eeros/logger/Logger.hpp>
+#include <eeros/logger/StreamLogWriter.hpp>
+#include <eeros/core/Version.hpp>
+#include <eeros/core/Executor.hpp>
+#include <eeros/core/System.hpp>
+#include <eeros/task/Periodic.hpp>
+#include <eeros/task/Lambda.hpp>
+#include <thread>
+
+/*
+* example with independent harmonic tasks running in parallel, 
+* the main task runs after all of them finished
+*/ 
+using namespace eeros::logger;
+using namespace eeros;
+
+int main() {
+  const double dt = 1.0;
+  Logger::setDefaultStreamLogger(std::cout);
+  Logger log = Logger::getLogger('M');
+  Logger log2 = Logger::getLogger('T');
+
+  log.trace() << "harmonic tasks example 4";
+
+  Executor& executor = Executor::instance();
+
+  task::Lambda lmainTask ([&] () {
+    log.info() << "run main task at timestamp " << (long)System::getTimeNs();
+  });
+  task::Periodic mainTask("main task", dt, lmainTask);
+  executor.setMainTask(mainTask);
+
+  task::Lambda t1 ([&] () {
+    log2.info() << "run axis 1 at timestamp " << (long)System::getTimeNs();
+    std::this_thread::sleep_for(std::chrono::microseconds((int)(dt * 300000)));
+  });
+  task::Periodic axis1("axis 1", dt, t1);
+  axis1.setIndependent(true);
+  axis1.setAffinity({0});
+
+  task::Lambda t2 ([&] () {
+    log2.info() << "run axis 2 at timestamp " << (long)System::getTimeNs();
+    std::this_thread::sleep_for(std::chrono::microseconds((int)(dt * 300000)));
+  });
+  task::Periodic axis2("axis 2", dt, t2);
+  axis2.setIndependent(true);
+  axis2.setAffinity({1});
+
+  mainTask.monitors.push_back([](eeros::PeriodicCounter &c, Logger &log){
+    static int ticks = 0;
+    if (++ticks < 10) return;
+    ticks = 0;
+    log.info() << "mainTask: period max: " << c.period.max << "   run max: " << c.run.max << "   run mean: " << c.run.mean;
+    c.reset();
+  });
+
+  executor.add(axis1);
+  executor.add(axis2);
+
+  executor.run();
+
+  return 0;
+}
@@ -2,7 +2,10 @@
 #define ORG_EEROS_CONTROL_BLOCK_HPP_
 
 #include <string>
+#include <vector>
+#include <eeros/types.hpp>
 #include <eeros/core/Runnable.hpp>
+#include <eeros/control/InputInterface.hpp>
 
 namespace eeros {
 namespace control {
@@ -28,9 +31,57 @@ class Block : public Runnable {
    * @return name
    */
   virtual std::string getName() const;
+
+  /**
+   * Gets the inputs owned by the block. An input registers itself 
+   * as soon as its owner is set.
+   * 
+   * @return inputs
+   */
+  const std::vector<InputInterface*>& getInputs() const;
+
+  /**
+   * Registers an input owned by the block.
+   * 
+   * @param input - input
+   */
+  void registerInput(InputInterface* input);
+
+  /**
+   * Removes an input from the inputs owned by the block.
+   * 
+   * @param input - input
+   */
+  void unregisterInput(InputInterface* input);
+
+  /**
+   * Chooses the timestamp of the outputs of the block. By default, a block stamps its 
+   * outputs with the start time of the cycle of its timedomain, see \ref CycleContext. 
+   * Blocks reading hardware can be made to read the clock when their data is acquired.
+   * 
+   * @param value - true, to read the clock instead of using the cycle time
+   */
+  void setAcquisitionTimestamps(bool value);
+
+  /**
+   * Gets the acquisition timestamp flag.
+   * 
+   * @return true, if the block reads the clock for its timestamps
+   */
+  bool getAcquisitionTimestamps() const;
+
+  /**
+   * Gets the timestamp for the outputs of the block. This is the start time of 
+   * the current cycle or the current time if acquisition timestamps are chosen.
+   * 
+   * @return timestamp in ns
+   */
+  timestamp_t getTimestamp() const;
   
  private:
   std::string name;
+  bool acquisitionTimestamps = false;
+  std::vector<InputInterface*> inputs;
 };
 
 };
@@ -49,7 +49,7 @@ class Constant : public Blockio<0,1,T> {
   virtual void run() {
     std::lock_guard<std::mutex> lock(mtx);
     this->out.getSignal().setValue(value);
-    this->out.getSignal().setTimestamp(System::getTimeNs());
+    this->out.getSignal().setTimestamp(this->getTimestamp());
   }
   
   /**
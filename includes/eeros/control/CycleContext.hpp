@@ -0,0 +1,67 @@
+#ifndef ORG_EEROS_CONTROL_CYCLECONTEXT_HPP_
+#define ORG_EEROS_CONTROL_CYCLECONTEXT_HPP_
+
+#include <eeros/types.hpp>
+#include <eeros/core/System.hpp>
+
+namespace eeros {
+namespace control {
+
+/**
+ * The cycle context holds the time at which the current cycle of a timedomain
+ * started. A timedomain reads the clock once per run and publishes the time to
+ * all threads running its blocks. Blocks stamp their outputs with it instead of
+ * reading the clock themselves, so all outputs of a cycle carry the same timestamp
+ * and a cycle costs a single clock read. Reading the cycle time is a thread local load.
+ *
+ * Outside of a cycle, e.g. if a block is run directly, the current system time is
+ * returned instead.
+ *
+ * @since v1.4
+ */
+class CycleContext {
+ public:
+  /**
+   * Gets the start time of the current cycle.
+   *
+   * @return time in ns, the current system time if no cycle is running on this thread
+   */
+  static timestamp_t now() {
+    return time != 0 ? time : System::getTimeNs();
+  }
+
+  /**
+   * Checks whether a cycle is running on this thread.
+   *
+   * @return true, if a cycle is running
+   */
+  static bool isActive() {
+    return time != 0;
+  }
+
+  /**
+   * Publishes the start time of a cycle to the calling thread for the lifetime
+   * of the scope. The previous time is restored afterwards, so cycles may nest.
+   */
+  class Scope {
+   public:
+    Scope(timestamp_t t) : prev(time) {
+      time = t;
+    }
+    ~Scope() {
+      time = prev;
+    }
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+   private:
+    timestamp_t prev;
+  };
+
+ private:
+  static inline thread_local timestamp_t time = 0;
+};
+
+}
+}
+
+#endif /* ORG_EEROS_CONTROL_CYCLECONTEXT_HPP_ */
@@ -35,14 +35,14 @@ class D: public Blockio<1,1,T> {
    * its memory. Therefore, the output will be set to zero.
    */
   virtual void run() {
-    Signal<T> sig = this->in.getSignal(); 
+    const Signal<T>& sig = this->in.getSignalFast(); 
     double tin = sig.getTimestamp() / 1000000000.0;
     double tprev = prev.getTimestamp() / 1000000000.0;
     T valin = sig.getValue();
     T valprev = prev.getValue();
       
     if (first) {
-      prev = this->in.getSignal();
+      prev = this->in.getSignalFast();
       valOut = 0;
       timeOut = sig.getTimestamp();
       first = false;
@@ -38,8 +38,8 @@ class DeMux: public Blockio<1,N,C,T> {
    */
   virtual void run() {
     for(uint32_t i = 0; i < N; i++) {
-      this->out[i].getSignal().setValue(this->in.getSignal().getValue()(i));
-      this->out[i].getSignal().setTimestamp(this->in.getSignal().getTimestamp());
+      this->out[i].getSignal().setValue(this->in.getSignalFast().getValue()(i));
+      this->out[i].getSignal().setTimestamp(this->in.getSignalFast().getTimestamp());
     }
   }
       
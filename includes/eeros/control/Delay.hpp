@@ -50,8 +50,8 @@ class Delay : public Blockio<1,1,T> {
    * Runs the delay block.   
    */
   virtual void run() {
-    buf[index] = this->in.getSignal().getValue();
-    timeBuf[index] = this->in.getSignal().getTimestamp();
+    buf[index] = this->in.getSignalFast().getValue();
+    timeBuf[index] = this->in.getSignalFast().getTimestamp();
     index++;
     if (index == bufLen) {
       index = 0;
@@ -2,9 +2,9 @@
 #define ORG_EEROS_CONTROL_GAIN_HPP_
 
 #include <eeros/control/Blockio.hpp>
+#include <eeros/core/ParameterSet.hpp>
 #include <type_traits>
 #include <memory>
-#include <mutex>
 #include <math.h>
 
 
@@ -24,9 +24,9 @@ namespace control {
  * The non-type template argument specifies if the multiplication will be done
  * element wise in case the gain is used with matrices.
  *
- * A gain block is suitable for use with multiple threads. However,
- * enabling/disabling of the gain and the smooth change feature
- * is not synchronized.
+ * A gain block is suitable for use with multiple threads. All settings
+ * are published as a whole to the thread running the block without
+ * locking it, see \ref ParameterSet. They take effect with the next run.
  *
  * @tparam Tout - output type (double - default type)
  * @tparam Tgain - gain type (double - default type)
@@ -56,7 +56,9 @@ class Gain : public Blockio<1,1,Tout> {
    * @param c - initial gain value
    */
   Gain(Tgain c) : Gain(c, 1.0, -1.0) { // 1.0 and -1.0 are temp values only.
-    resetMinMaxGain<Tgain>(); // set limits to smallest/largest value.
+    params.update([this](Parameters& p) {
+      resetMinMaxGain<Tgain>(p.minGain, p.maxGain); // set limits to smallest/largest value.
+    });
   }
 
 
@@ -72,10 +74,12 @@ class Gain : public Blockio<1,1,Tout> {
    */
   Gain(Tgain c, Tgain maxGain, Tgain minGain) {
     gain = c;
-    this->maxGain = maxGain;
-    this->minGain = minGain;
-    targetGain = gain;
-    gainDiff = 0;
+    params.update([&](Parameters& p) {
+      p.maxGain = maxGain;
+      p.minGain = minGain;
+      p.targetGain = c;
+      p.gainDiff = 0;
+    });
   }
 
   
@@ -90,7 +94,7 @@ class Gain : public Blockio<1,1,Tout> {
    *
    * Performs the smooth change if smooth change is enabled with enableSmoothChange(bool).
    * A smooth change of the gain is performed by adding or subtracting a gain differential
-   * specifiable by setGainDiff(Tgain).
+   * specifiable by setGainDiff(Tgain). Without smooth change, the gain jumps to the target gain.
    *
    * Checks if gain is in the band in between minGain and maxGain or correct it otherwise.
    * The correction is done by setting the maxGain or minGain to gain.
@@ -105,40 +109,42 @@ class Gain : public Blockio<1,1,Tout> {
    * @see disable()
    */
   virtual void run() {
-    std::lock_guard<std::mutex> lock(mtx);
+    const Parameters& p = params.read();
 
-    if (smoothChange) {
-      if (gain < targetGain) {
-        gain += gainDiff;
-        if (gain > targetGain) { // overshoot case.
-          gain = targetGain;
+    if (p.smoothChange) {
+      if (gain < p.targetGain) {
+        gain += p.gainDiff;
+        if (gain > p.targetGain) { // overshoot case.
+          gain = p.targetGain;
         }
       }
 
-      if (gain > targetGain) {
-        gain -= gainDiff;
-        if (gain < targetGain) {
-          gain = targetGain;
+      if (gain > p.targetGain) {
+        gain -= p.gainDiff;
+        if (gain < p.targetGain) {
+          gain = p.targetGain;
         }
       }
+    } else {
+      gain = p.targetGain;
     }
 
-    if (gain > maxGain) { // if diff will cause gain to be too large.
-      gain = maxGain;
+    if (gain > p.maxGain) { // if diff will cause gain to be too large.
+      gain = p.maxGain;
     }
 
-    if (gain < minGain) {
-      gain = minGain;
+    if (gain < p.minGain) {
+      gain = p.minGain;
     }
 
-    if (enabled) {
-      if (parabolic) this->out.getSignal().setValue(calculateParabolic<Tout,Tgain>(this->in.getSignal().getValue()));
-      else this->out.getSignal().setValue(calculate<Tout>(this->in.getSignal().getValue()));
+    if (p.enabled) {
+      if (p.parabolic) this->out.getSignal().setValue(calculateParabolic<Tout,Tgain>(this->in.getSignalFast().getValue()));
+      else this->out.getSignal().setValue(calculate<Tout>(this->in.getSignalFast().getValue()));
     } else {
-      this->out.getSignal().setValue(this->in.getSignal().getValue());
+      this->out.getSignal().setValue(this->in.getSignalFast().getValue());
     }
 
-    this->out.getSignal().setTimestamp(this->in.getSignal().getTimestamp());
+    this->out.getSignal().setTimestamp(this->in.getSignalFast().getTimestamp());
   }
 
 
@@ -153,7 +159,7 @@ class Gain : public Blockio<1,1,Tout> {
    * @see enableSmoothChange(bool)
    */
   virtual void enable() {
-    enabled = true;
+    params.update([](Parameters& p) { p.enabled = true; });
   }
 
 
@@ -168,7 +174,7 @@ class Gain : public Blockio<1,1,Tout> {
    * @see enableSmoothChange(bool)
    */
   virtual void disable() {
-    enabled = false;
+    params.update([](Parameters& p) { p.enabled = false; });
   }
 
 
@@ -186,7 +192,7 @@ class Gain : public Blockio<1,1,Tout> {
    * @see disable()
    */
   virtual void enableSmoothChange(bool enable) {
-    smoothChange = enable;
+    params.update([enable](Parameters& p) { p.smoothChange = enable; });
   }
   
   
@@ -203,29 +209,23 @@ class Gain : public Blockio<1,1,Tout> {
    * @see setParabolicGainParams()
    */
   virtual void enableParabolicGain(bool enable) {
-    parabolic = enable;
+    params.update([enable](Parameters& p) { p.parabolic = enable; });
   }
 
   
   /**
-   * Sets the gain value if smooth change is disabled and c is in the band in between minGain and maxGain.
-   *
-   * Sets the target gain value if smooth change is enabled and c is in the band in between minGain and maxGain.
+   * Sets the target gain value if c is in the band in between minGain and maxGain.
+   * The gain jumps to the target gain with the next run if smooth change is disabled
+   * and approaches it if smooth change is enabled.
    *
-   * Does not change gain or target gain value otherwise.
+   * Does not change the target gain value otherwise.
    *
    * @param c - gain value
    */
   virtual void setGain(Tgain c) {
-    std::lock_guard<std::mutex> lock(mtx);
-
-    if (c <= maxGain && c >= minGain) {
-      if (smoothChange) {
-        targetGain = c;
-      } else {
-        gain = c;
-      }
-    }
+    params.update([&c](Parameters& p) {
+      if (c <= p.maxGain && c >= p.minGain) p.targetGain = c;
+    });
   }
 
 
@@ -235,8 +235,7 @@ class Gain : public Blockio<1,1,Tout> {
    * @param maxGain - maximum allowed gain value
    */
   virtual void setMaxGain(Tgain maxGain) {
-    std::lock_guard<std::mutex> lock(mtx);
-    this->maxGain = maxGain;
+    params.update([&maxGain](Parameters& p) { p.maxGain = maxGain; });
   }
 
 
@@ -246,8 +245,7 @@ class Gain : public Blockio<1,1,Tout> {
    * @param minGain - minimum allowed gain value
    */
   virtual void setMinGain(Tgain minGain) {
-    std::lock_guard<std::mutex> lock(mtx);
-    this->minGain = minGain;
+    params.update([&minGain](Parameters& p) { p.minGain = minGain; });
   }
 
   /**
@@ -256,8 +254,7 @@ class Gain : public Blockio<1,1,Tout> {
    * @param gainDiff - gain differential
    */
   virtual void setGainDiff(Tgain gainDiff) {
-    std::lock_guard<std::mutex> lock(mtx);
-    this->gainDiff = gainDiff;
+    params.update([&gainDiff](Parameters& p) { p.gainDiff = gainDiff; });
   }
 
   /**
@@ -266,8 +263,7 @@ class Gain : public Blockio<1,1,Tout> {
    * @param parabolicSwitchPoint - input limit
    */
   virtual void setParabolicGainParams(Tout parabolicSwitchPoint) {
-    std::lock_guard<std::mutex> lock(mtx);
-    this->parabolicSwitchPoint = parabolicSwitchPoint;
+    params.update([&parabolicSwitchPoint](Parameters& p) { p.parabolicSwitchPoint = parabolicSwitchPoint; });
   }
 
   /*
@@ -278,16 +274,19 @@ class Gain : public Blockio<1,1,Tout> {
   friend std::ostream &operator<<(std::ostream &os, Gain<Xout, Xgain> &gain);
 
  protected:
+  struct Parameters {
+    Tgain maxGain;
+    Tgain minGain;
+    Tgain targetGain;
+    Tgain gainDiff;
+    bool enabled{true};
+    bool smoothChange{false};
+    bool parabolic{false};
+    Tout parabolicSwitchPoint;
+  };
+
   Tgain gain;
-  Tgain maxGain;
-  Tgain minGain;
-  Tgain targetGain;
-  Tgain gainDiff;
-  bool enabled{true};
-  bool smoothChange{false};
-  bool parabolic{false};
-  Tout parabolicSwitchPoint;
-  std::mutex mtx;
+  ParameterSet<Parameters> params;
 
  private:
   template<typename R>
@@ -303,10 +302,11 @@ class Gain : public Blockio<1,1,Tout> {
   
   template<typename R, typename S>  // Tout, Tgain
   typename std::enable_if<std::is_arithmetic<R>::value, R>::type calculateParabolic(R value) {
+    const Tout& switchPoint = params.current().parabolicSwitchPoint;
     Tout outVal;
-    if (fabs(value) > parabolicSwitchPoint) {
-      if (value >= 0) outVal = gain * sqrt(parabolicSwitchPoint * (2 * value - parabolicSwitchPoint));
-      else outVal = gain * -sqrt(parabolicSwitchPoint * (-2 * value - parabolicSwitchPoint));
+    if (fabs(value) > switchPoint) {
+      if (value >= 0) outVal = gain * sqrt(switchPoint * (2 * value - switchPoint));
+      else outVal = gain * -sqrt(switchPoint * (-2 * value - switchPoint));
     } else {
       outVal = gain * value;
     }
@@ -315,11 +315,12 @@ class Gain : public Blockio<1,1,Tout> {
   
   template<typename R, typename S>
   typename std::enable_if<std::is_compound<R>::value && std::is_arithmetic<S>::value && !elementWise, R>::type calculateParabolic(R value) {
+    const Tout& switchPoint = params.current().parabolicSwitchPoint;
     Tout outVal;
     for (unsigned int i = 0; i < value.size(); i++) {
-      if (fabs(value[i]) > parabolicSwitchPoint[i]) {
-        if (value[i] >= 0) outVal[i] = gain * sqrt(parabolicSwitchPoint[i] * (2 * value[i] - parabolicSwitchPoint[i]));
-        else outVal[i] = gain * -sqrt(parabolicSwitchPoint[i] * (-2 * value[i] - parabolicSwitchPoint[i]));
+      if (fabs(value[i]) > switchPoint[i]) {
+        if (value[i] >= 0) outVal[i] = gain * sqrt(switchPoint[i] * (2 * value[i] - switchPoint[i]));
+        else outVal[i] = gain * -sqrt(switchPoint[i] * (-2 * value[i] - switchPoint[i]));
       } else {
         outVal[i] = gain * value[i];
       }
@@ -343,11 +344,12 @@ class Gain : public Blockio<1,1,Tout> {
 
   template<typename R, typename S>
   typename std::enable_if<std::is_compound<R>::value && std::is_compound<S>::value && elementWise, R>::type calculateParabolic(R value) {
+    const Tout& switchPoint = params.current().parabolicSwitchPoint;
     Tout outVal;
     for (unsigned int i = 0; i < value.size(); i++) {
-      if (fabs(value[i]) > parabolicSwitchPoint[i]) {
-        if (value[i] >= 0) outVal[i] = gain[i] * sqrt(parabolicSwitchPoint[i] * (2 * value[i] - parabolicSwitchPoint[i]));
-        else outVal[i] = gain[i] * -sqrt(parabolicSwitchPoint[i] * (-2 * value[i] - parabolicSwitchPoint[i]));
+      if (fabs(value[i]) > switchPoint[i]) {
+        if (value[i] >= 0) outVal[i] = gain[i] * sqrt(switchPoint[i] * (2 * value[i] - switchPoint[i]));
+        else outVal[i] = gain[i] * -sqrt(switchPoint[i] * (-2 * value[i] - switchPoint[i]));
       } else {
         outVal[i] = gain[i] * value[i];
       }
@@ -356,20 +358,20 @@ class Gain : public Blockio<1,1,Tout> {
   }
      
   template<typename S>
-  typename std::enable_if<std::is_integral<S>::value>::type resetMinMaxGain() {
+  typename std::enable_if<std::is_integral<S>::value>::type resetMinMaxGain(Tgain& minGain, Tgain& maxGain) {
     minGain = std::numeric_limits<int32_t>::min();
     maxGain = std::numeric_limits<int32_t>::max();
   }
 
   template<typename S>
-  typename std::enable_if<std::is_floating_point<S>::value>::type resetMinMaxGain() {
+  typename std::enable_if<std::is_floating_point<S>::value>::type resetMinMaxGain(Tgain& minGain, Tgain& maxGain) {
     minGain = std::numeric_limits<double>::lowest();
     maxGain = std::numeric_limits<double>::max();
   }
 
   template<typename S>
   typename std::enable_if<!std::is_arithmetic<S>::value && std::is_integral<typename S::value_type>::value>::type
-  resetMinMaxGain() {
+  resetMinMaxGain(Tgain& minGain, Tgain& maxGain) {
     minGain.fill(std::numeric_limits<int32_t>::min());
     maxGain.fill(std::numeric_limits<int32_t>::max());
   }
@@ -377,7 +379,7 @@ class Gain : public Blockio<1,1,Tout> {
   template<typename S>
   typename std::enable_if<
       !std::is_arithmetic<S>::value && std::is_floating_point<typename S::value_type>::value>::type
-  resetMinMaxGain() {
+  resetMinMaxGain(Tgain& minGain, Tgain& maxGain) {
     minGain.fill(std::numeric_limits<double>::lowest());
     maxGain.fill(std::numeric_limits<double>::max());
   }
@@ -391,10 +393,11 @@ class Gain : public Blockio<1,1,Tout> {
  */
 template<typename Tout, typename Tgain>
 std::ostream &operator<<(std::ostream &os, Gain<Tout, Tgain> &gain) {
-  os << "Block Gain: '" << gain.getName() << "' is enabled=" << gain.enabled << ", gain=" << gain.gain << ", ";
-  os << "smoothChange=" << gain.smoothChange << ", minGain=" << gain.minGain << ", maxGain=" << gain.maxGain;
-  os << ", targetGain=" << gain.targetGain << ", gainDiff=" << gain.gainDiff;
-  os << ", parabolic=" << gain.parabolic << ", parabolicSwitchPoint=" << gain.parabolicSwitchPoint;
+  auto p = gain.params.get();
+  os << "Block Gain: '" << gain.getName() << "' is enabled=" << p.enabled << ", gain=" << gain.gain << ", ";
+  os << "smoothChange=" << p.smoothChange << ", minGain=" << p.minGain << ", maxGain=" << p.maxGain;
+  os << ", targetGain=" << p.targetGain << ", gainDiff=" << p.gainDiff;
+  os << ", parabolic=" << p.parabolic << ", parabolicSwitchPoint=" << p.parabolicSwitchPoint;
   return os;
 }
 
@@ -5,8 +5,8 @@
 #include <eeros/logger/Logger.hpp>
 #include <eeros/safety/SafetyLevel.hpp>
 #include <eeros/safety/SafetySystem.hpp>
+#include <eeros/core/ParameterSet.hpp>
 #include <cmath>
-#include <mutex>
 
 namespace eeros {
 namespace control {
@@ -21,6 +21,9 @@ namespace control {
  * enable() or disable() or it can depend on the current safety level.
  * If the current safety level is equal or greater than a preset level,
  * the integrator will be enabled.
+ * All settings, including the initial state, are published to the thread
+ * running the block without locking it and take effect with its next run,
+ * see \ref ParameterSet.
  *
  * @tparam T - output type (double - default type)
  * @since v0.6
@@ -31,7 +34,7 @@ class I: public Blockio<1,1,T> {
   /**
    * Constructs an integrator instance.\n
    */
-  I() : first(true), enabled(false), safetySystem(nullptr), activeLevel(nullptr) {
+  I() : first(true), init(0) {
     prev.clear(); 
     clearLimits();
   }
@@ -51,26 +54,37 @@ class I: public Blockio<1,1,T> {
    * @see disable()
    */
   virtual void run() override {
-    std::lock_guard<std::mutex> lock(mtx);
-    if (activeLevel != nullptr)
-      enabled =  safetySystem->getCurrentLevel() >= *activeLevel;
-    double tin = this->in.getSignal().getTimestamp() / 1000000000.0;
+    if (params.acquire()) {
+      const Parameters& p = params.current();
+      if (p.init != init) {
+        prev.setValue(p.initValue);
+        init = p.init;
+      }
+      T val = prev.getValue();
+      if (val > p.upperLimit) prev.setValue(p.upperLimit);
+      if (val < p.lowerLimit) prev.setValue(p.lowerLimit);
+    }
+    const Parameters& p = params.current();
+    bool enabled = p.enabled;
+    if (p.activeLevel != nullptr)
+      enabled =  p.safetySystem->getCurrentLevel() >= *p.activeLevel;
+    double tin = this->in.getSignalFast().getTimestamp() / 1000000000.0;
     double tprev = this->prev.getTimestamp() / 1000000000.0;
     double dt;
     if (first) {
       dt = 0; 
       first = false;
     } else dt = (tin - tprev);
-    T valin = this->in.getSignal().getValue();
+    T valin = this->in.getSignalFast().getValue();
     T valprev = this->prev.getValue();
     T output;
     if (enabled) {
       T val = valprev + valin * dt;
-      if ((val < upperLimit) && (val > lowerLimit)) output = val; 
+      if ((val < p.upperLimit) && (val > p.lowerLimit)) output = val; 
       else output = valprev;
     } else output = valprev;
     this->out.getSignal().setValue(output);
-    this->out.getSignal().setTimestamp(this->in.getSignal().getTimestamp());
+    this->out.getSignal().setTimestamp(this->in.getSignalFast().getTimestamp());
     this->prev = this->out.getSignal();
   }
 
@@ -82,7 +96,7 @@ class I: public Blockio<1,1,T> {
    * @see disable()
    */
   virtual void enable() {
-    this->enabled = true;
+    params.update([](Parameters& p) { p.enabled = true; });
   }
 
   /**
@@ -93,7 +107,7 @@ class I: public Blockio<1,1,T> {
    * @see enable()
    */
   virtual void disable() {
-    this->enabled = false;
+    params.update([](Parameters& p) { p.enabled = false; });
   }
   
   /**
@@ -104,7 +118,10 @@ class I: public Blockio<1,1,T> {
    * @param val - initial state
    */
   virtual void setInitCondition(T val) {
-    this->prev.setValue(val);
+    params.update([&val](Parameters& p) {
+      p.initValue = val;
+      p.init++;
+    });
   }
   
   /**
@@ -117,11 +134,10 @@ class I: public Blockio<1,1,T> {
    * @param lower - lower limit
    */
   virtual void setLimit(T upper, T lower) {
-    this->upperLimit = upper;
-    this->lowerLimit = lower;
-    T val = prev.getValue();
-    if (val > upper) prev.setValue(upper);
-    if (val < lower) prev.setValue(lower);
+    params.update([&](Parameters& p) {
+      p.upperLimit = upper;
+      p.lowerLimit = lower;
+    });
   }
 
   /**
@@ -132,9 +148,10 @@ class I: public Blockio<1,1,T> {
    * @param level - SafetyLevel
    */
   virtual void setActiveLevel(safety::SafetySystem& ss, safety::SafetyLevel &level) {
-    std::lock_guard<std::mutex> lock(mtx);
-    safetySystem = &ss;
-    activeLevel = &level;
+    params.update([&](Parameters& p) {
+      p.safetySystem = &ss;
+      p.activeLevel = &level;
+    });
   }
 
   /*
@@ -145,31 +162,37 @@ class I: public Blockio<1,1,T> {
   friend std::ostream &operator<<(std::ostream &os, I<X> &i);
 
  protected:
+  struct Parameters {
+    bool enabled{false};
+    T upperLimit, lowerLimit;
+    T initValue;
+    uint32_t init{0};  // incremented with every new initial state
+    safety::SafetySystem *safetySystem{nullptr};
+    safety::SafetyLevel *activeLevel{nullptr};
+  };
+
   bool first;
-  bool enabled;
   Signal<T> prev;
-  T upperLimit, lowerLimit;
-  safety::SafetySystem *safetySystem;
-  safety::SafetyLevel *activeLevel;
-  std::mutex mtx{};
+  uint32_t init;  // initial state applied last
+  ParameterSet<Parameters> params;
   
  private:
   virtual void clearLimits() {
-    _clear<T>();
+    params.update([this](Parameters& p) { _clear<T>(p.upperLimit, p.lowerLimit); });
   }
-  template <typename S> typename std::enable_if<std::is_integral<S>::value>::type _clear() {
+  template <typename S> typename std::enable_if<std::is_integral<S>::value>::type _clear(T& upperLimit, T& lowerLimit) {
     upperLimit = std::numeric_limits<int32_t>::max();
     lowerLimit = std::numeric_limits<int32_t>::lowest();
   }
-  template <typename S> typename std::enable_if<std::is_floating_point<S>::value>::type _clear() {
+  template <typename S> typename std::enable_if<std::is_floating_point<S>::value>::type _clear(T& upperLimit, T& lowerLimit) {
     upperLimit = std::numeric_limits<double>::max();
     lowerLimit = std::numeric_limits<double>::lowest();
   }
-  template <typename S> typename std::enable_if<!std::is_arithmetic<S>::value && std::is_integral<typename S::value_type>::value>::type _clear() {
+  template <typename S> typename std::enable_if<!std::is_arithmetic<S>::value && std::is_integral<typename S::value_type>::value>::type _clear(T& upperLimit, T& lowerLimit) {
     upperLimit.fill(std::numeric_limits<int32_t>::max());
     lowerLimit.fill(std::numeric_limits<int32_t>::lowest());
   }
-  template <typename S> typename std::enable_if<   !std::is_arithmetic<S>::value && std::is_floating_point<typename S::value_type>::value>::type _clear() {
+  template <typename S> typename std::enable_if<   !std::is_arithmetic<S>::value && std::is_floating_point<typename S::value_type>::value>::type _clear(T& upperLimit, T& lowerLimit) {
     upperLimit.fill(std::numeric_limits<double>::max());
     lowerLimit.fill(std::numeric_limits<double>::lowest());
   }
@@ -183,8 +206,9 @@ class I: public Blockio<1,1,T> {
  */
 template <typename T>
 std::ostream& operator<<(std::ostream& os, I<T>& i) {
-  os << "Block integrator: '" << i.getName() << "' is enabled=" << i.enabled;
-  os << ", upperLimit=" << i.upperLimit << ", lowerLimit=" << i.lowerLimit; 
+  auto p = i.params.get();
+  os << "Block integrator: '" << i.getName() << "' is enabled=" << p.enabled;
+  os << ", upperLimit=" << p.upperLimit << ", lowerLimit=" << p.lowerLimit; 
   return os;
 }
 
@@ -5,6 +5,7 @@
 #include <eeros/control/Signal.hpp>
 #include <eeros/control/Output.hpp>
 #include <eeros/control/Block.hpp>
+#include <eeros/control/InputInterface.hpp>
 
 namespace eeros {
 namespace control {
@@ -18,19 +19,34 @@ namespace control {
  */
 
 template < typename T = double >
-class Input {
+class Input : public InputInterface {
  public:
   /**
    * Constructs an input instance.
    */
-  Input() : connectedOutput(nullptr), owner(nullptr) { }
+  Input() : connectedOutput(nullptr), owner(nullptr), frozenSignal(nullptr) { }
  
   /**
    * Constructs an input instance.
    *
    * @param owner - the block which owns this input
    */
-  Input(Block* owner) : connectedOutput(nullptr), owner(owner) { }
+  Input(Block* owner) : connectedOutput(nullptr), owner(owner), frozenSignal(nullptr) {
+    if (owner != nullptr) owner->registerInput(this);
+  }
+
+  /**
+   * Copies an input. The copy is not registered with the owner.
+   */
+  Input(const Input&) = default;
+  Input& operator=(const Input&) = default;
+
+  /**
+   * Removes the input from the inputs of its owner.
+   */
+  virtual ~Input() {
+    if (owner != nullptr) owner->unregisterInput(this);
+  }
 
   /**
    * Connects an existing output of any other block to this input.
@@ -61,6 +77,7 @@ class Input {
    */
   virtual void disconnect() {
     connectedOutput = nullptr;
+    frozenSignal = nullptr;
   }
 
   /**
@@ -85,6 +102,48 @@ class Input {
     if (owner != nullptr) name = owner->getName(); else name = "";
       throw NotConnectedFault("Read from an unconnected input in block '" + name + "'");
   }
+
+  /**
+   * Returns the signal which is carried by the output to which this input 
+   * is connected. Once the input is frozen, this is a plain pointer access
+   * without any virtual call. Otherwise it is the same as \ref getSignal.
+   * Blocks should read their inputs with this method in run().
+   * 
+   * @return signal 
+   */
+  Signal<T>& getSignalFast() {
+    if (frozenSignal != nullptr) return *frozenSignal;
+    return getSignal();
+  }
+
+  /**
+   * Resolves the signal which is carried by the connected output once and 
+   * caches a pointer to it, which \ref getSignalFast returns from now on. 
+   * Freeze an input only after the connections it reads through, e.g. of a 
+   * subsystem, are complete. Disconnecting the input unfreezes it.
+   * 
+   * @return true, if the input is connected and is frozen now
+   */
+  virtual bool freeze() {
+    frozenSignal = isConnected() ? &getSignal() : nullptr;
+    return frozenSignal != nullptr;
+  }
+
+  /**
+   * Drops the cached signal, \ref getSignalFast resolves the signal on every call again.
+   */
+  virtual void unfreeze() {
+    frozenSignal = nullptr;
+  }
+
+  /**
+   * Queries whether the input is frozen.
+   * 
+   * @return true, if the signal is cached
+   */
+  bool isFrozen() const {
+    return frozenSignal != nullptr;
+  }
             
   /**
    * Every input is owned by a block. Sets the owner of this input.
@@ -92,12 +151,33 @@ class Input {
    * @param block - owner of this input
    */
   virtual void setOwner(Block* block) {
+    if (owner != nullptr) owner->unregisterInput(this);
     owner = block;
+    if (owner != nullptr) owner->registerInput(this);
+  }
+
+  /**
+   * Gets the block which owns this input.
+   * 
+   * @return owner, nullptr if not set
+   */
+  virtual Block* getOwner() const {
+    return owner;
+  }
+
+  /**
+   * Gets the block which owns the output this input is connected to.
+   * 
+   * @return owner of the connected output, nullptr if not connected
+   */
+  virtual Block* getSourceBlock() const {
+    return connectedOutput != nullptr ? connectedOutput->getOwner() : nullptr;
   }
             
  protected:
   Output<T>* connectedOutput;
   Block* owner;
+  Signal<T>* frozenSignal;
  };
 
 }
@@ -0,0 +1,56 @@
+#ifndef ORG_EEROS_CONTROL_INPUTINTERFACE_HPP_
+#define ORG_EEROS_CONTROL_INPUTINTERFACE_HPP_
+
+namespace eeros {
+namespace control {
+
+class Block;
+
+/**
+ * Type independent view of an \ref Input. It tells which block reads from 
+ * which other block, which the \ref TimeDomain uses to order its blocks.
+ * 
+ * @since v1.4
+ */
+class InputInterface {
+ public:
+  virtual ~InputInterface() { }
+
+  /**
+   * Gets the block which owns this input.
+   * 
+   * @return owner, nullptr if not set
+   */
+  virtual Block* getOwner() const = 0;
+
+  /**
+   * Gets the block which owns the output this input is connected to.
+   * 
+   * @return owner of the connected output, nullptr if not connected or not known
+   */
+  virtual Block* getSourceBlock() const = 0;
+
+  /**
+   * Queries the connection state of this input.
+   * 
+   * @return true, if connected
+   */
+  virtual bool isConnected() const = 0;
+
+  /**
+   * Resolves the signal this input reads once, see \ref Input::freeze.
+   * 
+   * @return true, if the input is connected and could be frozen
+   */
+  virtual bool freeze() = 0;
+
+  /**
+   * Resolves the signal again on every read.
+   */
+  virtual void unfreeze() = 0;
+};
+
+}
+}
+
+#endif /* ORG_EEROS_CONTROL_INPUTINTERFACE_HPP_ */
@@ -33,6 +33,8 @@ class InputSub : public Input<T>, public Output<T> {
    * @param owner - the block which owns this input
    */
   InputSub(Block* owner) : Input<T>(owner) { }
+
+  using Input<T>::getOwner;
           
   /**
    * Returns the signal which is carried by the output to which
@@ -39,10 +39,10 @@ class Mux: public Blockio<N,1,T,C> {
   virtual void run() {
     C newValue;
     for (uint32_t i = 0; i < N; i++) {
-      newValue(i) = this->in[i].getSignal().getValue();
+      newValue(i) = this->in[i].getSignalFast().getValue();
     }
     this->out.getSignal().setValue(newValue);
-    this->out.getSignal().setTimestamp(this->in[0].getSignal().getTimestamp());
+    this->out.getSignal().setTimestamp(this->in[0].getSignalFast().getTimestamp());
   }
 
 };
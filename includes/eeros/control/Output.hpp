@@ -49,6 +49,15 @@ class Output {
     owner = block;
   }
 
+  /**
+   * Gets the block which owns this output.
+   * 
+   * @return owner, nullptr if not set
+   */
+  virtual Block* getOwner() const {
+    return owner;
+  }
+
  private:
   Signal<T> signal;
   Block* owner;
@@ -3,6 +3,7 @@
 
 #include <eeros/control/Blockio.hpp>
 #include <eeros/math/Matrix.hpp>
+#include <eeros/core/ParameterSet.hpp>
 
 
 namespace eeros {
@@ -26,6 +27,8 @@ namespace control {
  * If the input is a vector, then it is possible to choose if the algorithm applies elementwise or not.
  * If yes, rising_slew_rate and falling_slew_rate must be vectors. 
  * 
+ * Rates can be changed from other threads while the block runs, see \ref ParameterSet.
+ * 
  * @tparam Tout - output type (double - default type)
  * @tparam Trate - rate type (double - default type)
  * @tparam elementWise - apply element wise (false - default value). If true, then rates must be double.
@@ -45,8 +48,7 @@ class RateLimiter : public Blockio<1,1,Tout> {
    * @param rate - limit of the first derivative
    */
   RateLimiter(Trate rate) {
-    fallingRate = -rate;
-    risingRate = rate;
+    setRate(-rate, rate);
     outPrev.clear();
   }
   
@@ -57,8 +59,7 @@ class RateLimiter : public Blockio<1,1,Tout> {
    * @param rRate - limit of the first derivative in positive direction
    */
   RateLimiter(Trate fRate, Trate rRate) {
-    fallingRate = fRate;
-    risingRate = rRate;
+    setRate(fRate, rRate);
     outPrev.clear();
   }
   
@@ -77,19 +78,19 @@ class RateLimiter : public Blockio<1,1,Tout> {
    * Otherwise: output(i) = input(i)
    */
   virtual void run(){
-    std::lock_guard<std::mutex> lock(mtx);
-    Tout inVal = this->in.getSignal().getValue();
-    double tin = this->in.getSignal().getTimestamp() / 1000000000.0;
+    const Parameters& p = params.read();
+    Tout inVal = this->in.getSignalFast().getValue();
+    double tin = this->in.getSignalFast().getTimestamp() / 1000000000.0;
     double tprev = outPrev.getTimestamp() / 1000000000.0;
     Tout outVal = inVal;
-    if(enabled) {
+    if(p.enabled) {
       double dt = tin - tprev;
-      outVal = calculateResult<Tout>(inVal, dt);
+      outVal = calculateResult<Tout>(inVal, dt, p);
     }
     outPrev.setValue(outVal);
-    outPrev.setTimestamp(this->in.getSignal().getTimestamp());
+    outPrev.setTimestamp(this->in.getSignalFast().getTimestamp());
     this->out.getSignal().setValue(outVal);
-    this->out.getSignal().setTimestamp(this->in.getSignal().getTimestamp());
+    this->out.getSignal().setTimestamp(this->in.getSignalFast().getTimestamp());
   }
   
   /**
@@ -100,7 +101,7 @@ class RateLimiter : public Blockio<1,1,Tout> {
    * @see disable()
    */
   virtual void enable() {
-    enabled = true;
+    params.update([](Parameters& p) { p.enabled = true; });
   }
   
   /**
@@ -111,7 +112,7 @@ class RateLimiter : public Blockio<1,1,Tout> {
    * @see enable()
    */
   virtual void disable() {
-    enabled = false;
+    params.update([](Parameters& p) { p.enabled = false; });
   }
   
   /**
@@ -121,9 +122,10 @@ class RateLimiter : public Blockio<1,1,Tout> {
    * @param rRate - limit of the first derivative in positive direction
    */
   virtual void setRate(Trate fRate, Trate rRate) {
-    std::lock_guard<std::mutex> lock(mtx);
-    fallingRate = fRate;
-    risingRate = rRate;
+    params.update([&](Parameters& p) {
+      p.fallingRate = fRate;
+      p.risingRate = rRate;
+    });
   }
 
   /*
@@ -134,42 +136,45 @@ class RateLimiter : public Blockio<1,1,Tout> {
   friend std::ostream& operator<<(std::ostream& os, RateLimiter<X>& rl);
 
  private:
+  struct Parameters {
+    Trate fallingRate, risingRate;
+    bool enabled{false};
+  };
+
   Signal<Tout> outPrev;
-  Trate fallingRate, risingRate;
-  bool enabled{false};
-  std::mutex mtx;
+  ParameterSet<Parameters> params;
   
   template <typename S> 
-  typename std::enable_if<std::is_arithmetic<S>::value, S>::type calculateResult(S inValue, double dt) {
+  typename std::enable_if<std::is_arithmetic<S>::value, S>::type calculateResult(S inValue, double dt, const Parameters& p) {
     Tout outVal;
     Trate rate = (inValue - outPrev.getValue()) / dt;
-    if (rate > risingRate) outVal = dt * risingRate + outPrev.getValue();
-    else if (rate < fallingRate) outVal = dt * fallingRate + outPrev.getValue();
+    if (rate > p.risingRate) outVal = dt * p.risingRate + outPrev.getValue();
+    else if (rate < p.fallingRate) outVal = dt * p.fallingRate + outPrev.getValue();
     else outVal = inValue;
     return outVal;
   }
 
   template <typename S> 
-  typename std::enable_if<std::is_compound<S>::value && std::is_arithmetic<Trate>::value, S>::type calculateResult(S inValue, double dt) {
+  typename std::enable_if<std::is_compound<S>::value && std::is_arithmetic<Trate>::value, S>::type calculateResult(S inValue, double dt, const Parameters& p) {
     std::cout << " NOT element wise" << std::endl;
     Tout outVal;
     for (unsigned int i = 0; i < inValue.size(); i++) {
       double rate = (inValue[i] - outPrev.getValue()[i])/dt;
-      if (rate > risingRate) outVal[i] = dt * risingRate + outPrev.getValue()[i];
-      else if (rate < fallingRate) outVal[i] = dt * fallingRate + outPrev.getValue()[i];
+      if (rate > p.risingRate) outVal[i] = dt * p.risingRate + outPrev.getValue()[i];
+      else if (rate < p.fallingRate) outVal[i] = dt * p.fallingRate + outPrev.getValue()[i];
       else outVal[i] = inValue[i];
     }
     return outVal;
   }
   
   template <typename S> 
-  typename std::enable_if<std::is_compound<S>::value && std::is_compound<Trate>::value, S>::type calculateResult(S inValue, double dt) {
+  typename std::enable_if<std::is_compound<S>::value && std::is_compound<Trate>::value, S>::type calculateResult(S inValue, double dt, const Parameters& p) {
     std::cout << " element wise" << std::endl;
     Tout outVal;
     for (unsigned int i = 0; i < inValue.size(); i++) {
       double rate = (inValue[i] - outPrev.getValue()[i]) / dt;
-      if (rate > risingRate[i]) outVal[i] = dt * risingRate[i] + outPrev.getValue()[i];
-      else if (rate < fallingRate[i]) outVal[i] = dt * fallingRate[i] + outPrev.getValue()[i];
+      if (rate > p.risingRate[i]) outVal[i] = dt * p.risingRate[i] + outPrev.getValue()[i];
+      else if (rate < p.fallingRate[i]) outVal[i] = dt * p.fallingRate[i] + outPrev.getValue()[i];
       else outVal[i] = inValue[i];
     }
     return outVal;
@@ -184,7 +189,8 @@ class RateLimiter : public Blockio<1,1,Tout> {
  */
 template <typename T>
 std::ostream& operator<<(std::ostream& os, RateLimiter<T>& rl) {
-  os << "Block RateLimiter: '" << rl.getName() << "' falling rate=" << rl.fallingRate << ", rising rate=" << rl.risingRate; 
+  auto p = rl.params.get();
+  os << "Block RateLimiter: '" << rl.getName() << "' falling rate=" << p.fallingRate << ", rising rate=" << p.risingRate; 
   return os;
 }
 
@@ -3,7 +3,7 @@
 
 #include <eeros/control/Blockio.hpp>
 #include <eeros/math/Matrix.hpp>
-#include <mutex>
+#include <eeros/core/ParameterSet.hpp>
 #include <type_traits>
 
 namespace eeros {
@@ -13,6 +13,7 @@ namespace control {
  * A Saturation block limits an input value between two limit values.
  * The output value will always vary between lower and upper limit.
  * If the block is disabled, the output value will simply follow the input.
+ * Limits can be changed from other threads while the block runs, see \ref ParameterSet.
  * 
  * @tparam T - output type (double - default type) 
  *  
@@ -28,9 +29,8 @@ class Saturation : public Blockio<1,1,T> {
    * @param lower - lower limit
    * @param upper - upper limit
    */
-  Saturation(T lower, T upper) : enabled(true) {
-    lowerLimit = lower;
-    upperLimit = upper;
+  Saturation(T lower, T upper) {
+    setLimit(lower, upper);
   }
   
   /**
@@ -51,12 +51,12 @@ class Saturation : public Blockio<1,1,T> {
    * Runs the saturation algorithm, as described above.
    */
   virtual void run() {
-    std::lock_guard<std::mutex> lock(mtx);
-    T inVal = this->in.getSignal().getValue();
+    const Parameters& p = params.read();
+    T inVal = this->in.getSignalFast().getValue();
     T outVal = inVal;
-    if (enabled) outVal = calculateResult<T>(inVal);
+    if (p.enabled) outVal = calculateResult<T>(inVal, p);
     this->out.getSignal().setValue(outVal);
-    this->out.getSignal().setTimestamp(this->in.getSignal().getTimestamp());
+    this->out.getSignal().setTimestamp(this->in.getSignalFast().getTimestamp());
   }
   
   /**
@@ -67,7 +67,7 @@ class Saturation : public Blockio<1,1,T> {
    * @see disable()
    */
   virtual void enable() {
-    enabled = true;
+    params.update([](Parameters& p) { p.enabled = true; });
   }
   
   /**
@@ -78,7 +78,7 @@ class Saturation : public Blockio<1,1,T> {
    * @see enable()
    */
   virtual void disable() {
-    enabled = false;
+    params.update([](Parameters& p) { p.enabled = false; });
   }
   
   /**
@@ -88,32 +88,44 @@ class Saturation : public Blockio<1,1,T> {
    * @param upper - upper limit
    */
   virtual void setLimit(T lower, T upper) {
-    lowerLimit = lower;
-    upperLimit = upper;
+    params.update([&](Parameters& p) {
+      p.lowerLimit = lower;
+      p.upperLimit = upper;
+    });
   }
+
+  /*
+   * Friend operator overload to give the operator overload outside
+   * the class access to the private fields.
+   */
+  template <typename X>
+  friend std::ostream& operator<<(std::ostream& os, Saturation<X>& s);
   
  private:
+  struct Parameters {
+    T lowerLimit, upperLimit;
+    bool enabled{true};
+  };
+
   template <typename S> 
-  typename std::enable_if<std::is_arithmetic<S>::value, S>::type calculateResult(S inVal) {
+  typename std::enable_if<std::is_arithmetic<S>::value, S>::type calculateResult(S inVal, const Parameters& p) {
     T outVal = inVal;
-    if (inVal > upperLimit) outVal = upperLimit;
-    if (inVal < lowerLimit) outVal = lowerLimit;
+    if (inVal > p.upperLimit) outVal = p.upperLimit;
+    if (inVal < p.lowerLimit) outVal = p.lowerLimit;
     return outVal;
   }
 
   template <typename S> 
-  typename std::enable_if<std::is_compound<S>::value, S>::type calculateResult(S inVal) {
+  typename std::enable_if<std::is_compound<S>::value, S>::type calculateResult(S inVal, const Parameters& p) {
     T outVal = inVal;
     for (unsigned int i = 0; i < outVal.size(); i++) {
-      if (inVal[i] > upperLimit[i]) outVal[i] = upperLimit[i];
-      if (inVal[i] < lowerLimit[i]) outVal[i] = lowerLimit[i];
+      if (inVal[i] > p.upperLimit[i]) outVal[i] = p.upperLimit[i];
+      if (inVal[i] < p.lowerLimit[i]) outVal[i] = p.lowerLimit[i];
     }   
     return outVal;
   }
 
-  T lowerLimit, upperLimit;
-  bool enabled;
-  std::mutex mtx;
+  ParameterSet<Parameters> params;
 };
 
 /**
@@ -123,7 +135,8 @@ class Saturation : public Blockio<1,1,T> {
  */
 template <typename T>
 std::ostream& operator<<(std::ostream& os, Saturation<T>& s) {
-  os << "Block saturation: '" << s.getName() << "' lower limit=" << s.lowerLimit << ", upper limit=" << s.upperLimit; 
+  auto p = s.params.get();
+  os << "Block saturation: '" << s.getName() << "' lower limit=" << p.lowerLimit << ", upper limit=" << p.upperLimit; 
   return os;
 }
 
@@ -5,17 +5,24 @@
 #include <list>
 #include <type_traits>
 #include <limits>
+#include <sstream>
+#include <typeinfo>
+#include <atomic>
 #include <eeros/types.hpp>
 #include <eeros/control/SignalInterface.hpp>
+#include <eeros/control/SignalRegistry.hpp>
 
 namespace eeros {
 namespace control {
     
-extern uint16_t signalCounter;
+extern std::atomic<uint32_t> signalCounter;
       
 /**
  * A signal comprises several properties such as a value and a timestamp.
  * It is used to transport information between blocks of a control system.
+ * Every constructed signal is registered in the \ref SignalRegistry as long as 
+ * it exists. Copies share the id of the original and are not registered, so 
+ * copying a signal in a cycle neither locks nor allocates.
  *
  * @tparam T - signal type (double - default type)
  * @since v0.4
@@ -27,8 +34,25 @@ class Signal : public SignalInterface {
   /**
    * Constructs a signal instance.
    */
-  Signal() {
-   id = signalCounter++;
+  Signal() : registered(true) {
+    id = signalCounter.fetch_add(1, std::memory_order_relaxed);
+    SignalRegistry::instance().add(this);
+  }
+
+  /**
+   * Constructs a copy of a signal. The copy carries the same value, timestamp, 
+   * name and id, but is not registered.
+   * 
+   * @param other - signal to copy
+   */
+  Signal(const Signal<T>& other) 
+      : SignalInterface(), value(other.value), timestamp(other.timestamp), id(other.id), name(other.name), registered(false) { }
+
+  /**
+   * Destructs a signal and removes it from the registry.
+   */
+  virtual ~Signal() {
+    if (registered) SignalRegistry::instance().remove(this);
   }
       
   /**
@@ -55,7 +79,9 @@ class Signal : public SignalInterface {
    * @param name - name of the signal
    */
   virtual void setName(std::string name) {
+    std::string oldName = this->name;
     this->name = name;
+    if (registered) SignalRegistry::instance().rename(this, oldName);
   }
       
       virtual std::string getLabel() const {
@@ -112,6 +138,24 @@ class Signal : public SignalInterface {
     timestamp = newTimestamp;
   }
       
+  /**
+   * Gets the type of the value.
+   * 
+   * @return type
+   */
+  virtual const std::type_info& getType() const {
+    return typeid(T);
+  }
+
+  /**
+   * Gets the value formatted as text.
+   * 
+   * @return value, empty if the type cannot be printed
+   */
+  virtual std::string getValueString() const {
+    return _toString<T>(0);
+  }
+
   /**
    * Clears the signal to NaN.
    */
@@ -119,7 +163,7 @@ class Signal : public SignalInterface {
     _clear<T>();
   }
       
-  Signal<T>& operator= (Signal<T> right) {
+  Signal<T>& operator= (const Signal<T>& right) {
     value = right.value;
     timestamp = right.timestamp;
     return *this;
@@ -134,19 +178,37 @@ class Signal : public SignalInterface {
     return illegalSignal;
   }
       
+  /**
+   * Gets all signals of this type, see \ref SignalRegistry.
+   * 
+   * @return signals
+   */
   static std::list<SignalInterface*> getSignalList() {
-    return signalList;
+    std::list<SignalInterface*> signals;
+    for (auto s : SignalRegistry::instance().getSignals()) {
+      if (s->getType() == typeid(T)) signals.push_back(s);
+    }
+    return signals;
   }
       
-  static SignalInterface* getSignalById(sigid_t id) {
-    std::list<SignalInterface*>::iterator i = signalList.begin();
-    while(i != signalList.end()) {
-      if((*i)->getId() == id) {
-        return (*i);
-      }
-      i++;
-    }
-    return NULL;
+  /**
+   * Finds a signal of this type by its id, see \ref SignalRegistry.
+   * 
+   * @param id - id of the signal
+   * @return signal, nullptr if there is no signal of this type with this id
+   */
+  static Signal<T>* getSignalById(sigid_t id) {
+    return dynamic_cast<Signal<T>*>(SignalRegistry::instance().find(id));
+  }
+
+  /**
+   * Finds a signal of this type by its name, see \ref SignalRegistry.
+   * 
+   * @param name - name of the signal
+   * @return signal, nullptr if there is no signal of this type with this name
+   */
+  static Signal<T>* getSignalByName(const std::string& name) {
+    return dynamic_cast<Signal<T>*>(SignalRegistry::instance().find(name));
   }
       
  protected:
@@ -154,8 +216,17 @@ class Signal : public SignalInterface {
   timestamp_t timestamp; /** The timestamp marks the time when this signal was captured */
   sigid_t id; /** Each signal has an unique id which is assigned automatically upon creation */
   std::string name; /** Each signal can be named */
+  bool registered; /** Copies of a signal are not registered */
     
  private:
+  template <typename S> auto _toString(int) const -> decltype(std::declval<std::ostream&>() << std::declval<const S&>(), std::string()) {
+    std::ostringstream os;
+    os << value;
+    return os.str();
+  }
+  template <typename S> std::string _toString(long) const {
+    return "";
+  }
   template <typename S> typename std::enable_if<std::is_integral<S>::value>::type _clear() {
     value = std::numeric_limits<S>::min();
     timestamp = 0;
@@ -181,13 +252,9 @@ class Signal : public SignalInterface {
     timestamp = 0;
   }
       
-  static std::list<SignalInterface*> signalList;
   static Signal<T> illegalSignal;
 };
     
-template < typename T>
-std::list<SignalInterface*> Signal<T>::signalList;
-    
 template < typename T>
 Signal<T> Signal<T>::illegalSignal;
   
@@ -199,7 +266,7 @@ std::ostream& operator<<(std::ostream& os, Signal<T>& signal) {
 }
 template <typename T>
 std::ostream& operator<<(std::ostream& os, Signal<T>* signal) {
-  os << "Signal: '" << signal.getName() << "' timestamp = " << signal.getTimestamp() << " value = " << signal.getValue(); 
+  os << "Signal: '" << signal->getName() << "' timestamp = " << signal->getTimestamp() << " value = " << signal->getValue(); 
   return os;
 }
 
@@ -5,9 +5,10 @@
 #include <eeros/safety/SafetyLevel.hpp>
 #include <eeros/safety/SafetySystem.hpp>
 #include <eeros/logger/Logger.hpp>
+#include <eeros/core/ParameterSet.hpp>
 #include <type_traits>
 #include <memory>
-#include <mutex>
+#include <atomic>
 
 
 namespace eeros {
@@ -35,6 +36,8 @@ namespace control {
  * the norm of a vector must be limit checked.
  *
  * A signal checker block is suitable for use with multiple threads.
+ * Limits and safety settings are published to the thread running the
+ * block without locking it, see \ref ParameterSet.
  *
  * @tparam Tsig - signal type (double - default type)
  * @tparam Tlim - limit type (Tsig - default type)
@@ -55,14 +58,11 @@ class SignalChecker : public Blockio<1,0,Tsig> {
    * @param offRange - checks that the signal is lower than the lower limit or greater than the upper limit
    */
   SignalChecker(Tlim lowerLimit, Tlim upperLimit, bool offRange = false) 
-      : lowerLimit(lowerLimit),
-        upperLimit(upperLimit),
-        fired(false),
-        safetySystem(nullptr),
-        safetyEvent(nullptr),
-        activeLevel(nullptr),
+      : fired(false),
         log(logger::Logger::getLogger()), 
-        offRange(offRange) {}
+        offRange(offRange) {
+    setLimits(lowerLimit, upperLimit);
+  }
 
   /**
    * Runs the checker algorithm.
@@ -81,30 +81,30 @@ class SignalChecker : public Blockio<1,0,Tsig> {
    * @see setActiveLevel()
    */
   virtual void run() override {
-    std::lock_guard<std::mutex> lock(mtx);
+    const Parameters& p = params.read();
 
-    auto val = this->in.getSignal().getValue();
+    auto val = this->in.getSignalFast().getValue();
     if (!fired) {
       if (offRange) {
-        if (withinLimits<bool>(val)) {
-          if (safetySystem != nullptr && safetyEvent != nullptr) {
-            if (activeLevel == nullptr ||
-            (activeLevel != nullptr && safetySystem->getCurrentLevel() >= *activeLevel)
+        if (withinLimits<bool>(val, p)) {
+          if (p.safetySystem != nullptr && p.safetyEvent != nullptr) {
+            if (p.activeLevel == nullptr ||
+            (p.activeLevel != nullptr && p.safetySystem->getCurrentLevel() >= *p.activeLevel)
             ) {
               log.warn() << "Signal checker \'" + this->getName() + "\' fires!";
-              safetySystem->triggerEvent(*safetyEvent);
+              p.safetySystem->triggerEvent(*p.safetyEvent);
               fired = true;
             }
           }
         }
       } else {
-        if (limitsExceeded<bool>(val)) {
-          if (safetySystem != nullptr && safetyEvent != nullptr) {
-            if (activeLevel == nullptr ||
-            (activeLevel != nullptr && safetySystem->getCurrentLevel() >= *activeLevel)
+        if (limitsExceeded<bool>(val, p)) {
+          if (p.safetySystem != nullptr && p.safetyEvent != nullptr) {
+            if (p.activeLevel == nullptr ||
+            (p.activeLevel != nullptr && p.safetySystem->getCurrentLevel() >= *p.activeLevel)
             ) {
               log.warn() << "Signal checker \'" + this->getName() + "\' fires!";
-              safetySystem->triggerEvent(*safetyEvent);
+              p.safetySystem->triggerEvent(*p.safetyEvent);
               fired = true;
             }
           }
@@ -121,9 +121,10 @@ class SignalChecker : public Blockio<1,0,Tsig> {
    * @param upperLimit - upper limit value
    */
   virtual void setLimits(Tlim lowerLimit, Tlim upperLimit) {
-    std::lock_guard<std::mutex> lock(mtx);
-    this->lowerLimit = lowerLimit;
-    this->upperLimit = upperLimit;
+    params.update([&](Parameters& p) {
+      p.lowerLimit = lowerLimit;
+      p.upperLimit = upperLimit;
+    });
   }
 
 
@@ -131,7 +132,6 @@ class SignalChecker : public Blockio<1,0,Tsig> {
    * Resets the checker so it can fire a safety event again.
    */
   virtual void reset() {
-    std::lock_guard<std::mutex> lock(mtx);
     fired = false;
   }
 
@@ -143,9 +143,10 @@ class SignalChecker : public Blockio<1,0,Tsig> {
    * @param e - SafetyEvent
    */
   virtual void registerSafetyEvent(safety::SafetySystem &ss, safety::SafetyEvent &e) {
-    std::lock_guard<std::mutex> lock(mtx);
-    safetySystem = &ss;
-    safetyEvent = &e;
+    params.update([&](Parameters& p) {
+      p.safetySystem = &ss;
+      p.safetyEvent = &e;
+    });
   }
 
 
@@ -155,40 +156,42 @@ class SignalChecker : public Blockio<1,0,Tsig> {
    * @param level - SafetyLevel
    */
   virtual void setActiveLevel(safety::SafetyLevel &level) {
-    std::lock_guard<std::mutex> lock(mtx);
-    activeLevel = &level;
+    params.update([&](Parameters& p) { p.activeLevel = &level; });
   }
 
 
  protected:
-  Tlim lowerLimit, upperLimit;
-  bool fired;
-  safety::SafetySystem *safetySystem;
-  safety::SafetyEvent *safetyEvent;
-  safety::SafetyLevel *activeLevel;
+  struct Parameters {
+    Tlim lowerLimit, upperLimit;
+    safety::SafetySystem *safetySystem{nullptr};
+    safety::SafetyEvent *safetyEvent{nullptr};
+    safety::SafetyLevel *activeLevel{nullptr};
+  };
+
+  ParameterSet<Parameters> params;
+  std::atomic<bool> fired;
   eeros::logger::Logger log;
-  std::mutex mtx{};
   bool offRange;
 
  private:
   template<typename S>
-  typename std::enable_if<!checkNorm, S>::type limitsExceeded(Tsig value) {
-    return !(value > lowerLimit && value < upperLimit);
+  typename std::enable_if<!checkNorm, S>::type limitsExceeded(Tsig value, const Parameters& p) {
+    return !(value > p.lowerLimit && value < p.upperLimit);
   }
 
   template<typename S>
-  typename std::enable_if<checkNorm, S>::type limitsExceeded(Tsig value) {
-    return !(value.norm() > lowerLimit && value.norm() < upperLimit);
+  typename std::enable_if<checkNorm, S>::type limitsExceeded(Tsig value, const Parameters& p) {
+    return !(value.norm() > p.lowerLimit && value.norm() < p.upperLimit);
   }
 
   template<typename S>
-  typename std::enable_if<!checkNorm, S>::type withinLimits(Tsig value) {
-    return (value > lowerLimit && value < upperLimit);
+  typename std::enable_if<!checkNorm, S>::type withinLimits(Tsig value, const Parameters& p) {
+    return (value > p.lowerLimit && value < p.upperLimit);
   }
 
   template<typename S>
-  typename std::enable_if<checkNorm, S>::type withinLimits(Tsig value) {
-    return (value.norm() > lowerLimit && value.norm() < upperLimit);
+  typename std::enable_if<checkNorm, S>::type withinLimits(Tsig value, const Parameters& p) {
+    return (value.norm() > p.lowerLimit && value.norm() < p.upperLimit);
   }
 
 };
@@ -4,6 +4,7 @@
 #include <string>
 #include <sstream>
 #include <vector>
+#include <typeinfo>
 #include <eeros/types.hpp>
 
 namespace eeros {
@@ -13,12 +14,30 @@ namespace eeros {
 		
 		class SignalInterface {
 		public:
+			virtual ~SignalInterface() { }
       
 			virtual sigid_t getId() const = 0;
 			
 			virtual std::string getName() const = 0;
 			
 			virtual std::string getLabel() const = 0;
+			
+			virtual timestamp_t getTimestamp() const = 0;
+			
+			/**
+			 * Gets the type of the value, e.g. to cast to the concrete signal.
+			 * 
+			 * @return type of the value
+			 */
+			virtual const std::type_info& getType() const = 0;
+			
+			/**
+			 * Gets the value formatted as text, for types which cannot be 
+			 * printed to a stream an empty string.
+			 * 
+			 * @return value
+			 */
+			virtual std::string getValueString() const = 0;
 		};
 	};
 };
@@ -0,0 +1,102 @@
+#ifndef ORG_EEROS_CONTROL_SIGNALREGISTRY_HPP_
+#define ORG_EEROS_CONTROL_SIGNALREGISTRY_HPP_
+
+#include <mutex>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <eeros/types.hpp>
+#include <eeros/control/SignalInterface.hpp>
+
+namespace eeros {
+namespace control {
+
+/**
+ * The signal registry knows all signals of the process. Signals register themselves
+ * upon construction and unregister upon destruction. A signal can be found by its id
+ * or by its name in constant time, without walking the blocks of a control system.
+ * Diagnostics, tracing or remote inspection tools use the type erased
+ * \ref SignalInterface to read it.
+ *
+ * Names can be hierarchical, e.g. "axis1/position", they are compared as a whole.
+ * If several signals share a name, any of them is found. Unnamed signals can only
+ * be found by their id.
+ *
+ * The registry is locked by a mutex. Signals are constructed and named during setup,
+ * do not look up signals in a realtime loop.
+ *
+ * @since v1.4
+ */
+class SignalRegistry {
+ public:
+  /**
+   * Get the signal registry instance as a singleton
+   */
+  static SignalRegistry& instance();
+
+  SignalRegistry(SignalRegistry const&) = delete;
+  void operator=(SignalRegistry const&) = delete;
+
+  /**
+   * Registers a signal with its id and name.
+   *
+   * @param signal - signal
+   */
+  void add(SignalInterface* signal);
+
+  /**
+   * Removes a signal from the registry.
+   *
+   * @param signal - signal
+   */
+  void remove(SignalInterface* signal);
+
+  /**
+   * Updates the name under which a signal is found.
+   *
+   * @param signal - signal
+   * @param oldName - name the signal was registered with
+   */
+  void rename(SignalInterface* signal, const std::string& oldName);
+
+  /**
+   * Finds a signal by its id.
+   *
+   * @param id - id of the signal, see \ref SignalInterface::getId
+   * @return signal, nullptr if not found
+   */
+  SignalInterface* find(sigid_t id);
+
+  /**
+   * Finds a signal by its name.
+   *
+   * @param name - name of the signal
+   * @return signal, nullptr if not found
+   */
+  SignalInterface* find(const std::string& name);
+
+  /**
+   * Gets all registered signals ordered by their id.
+   *
+   * @return signals
+   */
+  std::vector<SignalInterface*> getSignals();
+
+  /**
+   * Gets the number of registered signals.
+   *
+   * @return number of signals
+   */
+  std::size_t size();
+
+ private:
+  SignalRegistry() { }
+  std::mutex mtx;
+  std::unordered_map<sigid_t, SignalInterface*> ids;
+  std::unordered_multimap<std::string, SignalInterface*> names;
+};
+
+}
+}
+
+#endif /* ORG_EEROS_CONTROL_SIGNALREGISTRY_HPP_ */
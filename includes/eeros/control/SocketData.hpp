@@ -79,13 +79,13 @@ class SocketData<SigInType, SigOutType,
     }
     // send
     if (this->in.isConnected()) {
-      for(uint32_t i = 0; i < bufInLen; i++) sendData[i] = this->in.getSignal().getValue()(i);
+      for(uint32_t i = 0; i < bufInLen; i++) sendData[i] = this->in.getSignalFast().getValue()(i);
       if (isServer) server->setSendBuffer(sendData);
       else client->setSendBuffer(sendData);
     }
     
     this->out.getSignal().setValue(output);
-    timestamp_t time = System::getTimeNs();
+    timestamp_t time = this->getTimestamp();
     this->out.getSignal().setTimestamp(time);
   }
   
@@ -169,13 +169,13 @@ public:
     
     // send
     if (this->in.isConnected()) {
-      sendData[0] = this->in.getSignal().getValue();
+      sendData[0] = this->in.getSignalFast().getValue();
       if (isServer) server->setSendBuffer(sendData);
       else client->setSendBuffer(sendData);
     }
     
     this->out.getSignal().setValue(output);
-    timestamp_t time = System::getTimeNs();
+    timestamp_t time = this->getTimestamp();
     this->out.getSignal().setTimestamp(time);
   }
   
@@ -234,13 +234,13 @@ public:
     
     // send
     if (this->in.isConnected()) {
-      for(uint32_t i = 0; i < bufInLen; i++) sendData[i] = this->in.getSignal().getValue()(i);
+      for(uint32_t i = 0; i < bufInLen; i++) sendData[i] = this->in.getSignalFast().getValue()(i);
       if (isServer) server->setSendBuffer(sendData);
       else client->setSendBuffer(sendData);
     }
     
     this->out.getSignal().setValue(output);
-    timestamp_t time = System::getTimeNs();
+    timestamp_t time = this->getTimestamp();
     this->out.getSignal().setTimestamp(time);
   }
   
@@ -299,13 +299,13 @@ public:
     
     // send
     if (this->in.isConnected()) {
-      sendData[0] = this->in.getSignal().getValue();
+      sendData[0] = this->in.getSignalFast().getValue();
       if (isServer) server->setSendBuffer(sendData);
       else client->setSendBuffer(sendData);
     }
     
     this->out.getSignal().setValue(output);
-    timestamp_t time = System::getTimeNs();
+    timestamp_t time = this->getTimestamp();
     this->out.getSignal().setTimestamp(time);
   }
   
@@ -352,7 +352,7 @@ public:
   virtual void run() {
     // send
     if (this->in.isConnected()) {
-      for(uint32_t i = 0; i < bufInLen; i++) sendData[i] = this->in.getSignal().getValue()(i);
+      for(uint32_t i = 0; i < bufInLen; i++) sendData[i] = this->in.getSignalFast().getValue()(i);
       if (isServer) server->setSendBuffer(sendData);
       else client->setSendBuffer(sendData);
     }
@@ -403,7 +403,7 @@ public:
     }
             
     this->out.getSignal().setValue(output);
-    timestamp_t time = System::getTimeNs();
+    timestamp_t time = this->getTimestamp();
     this->out.getSignal().setTimestamp(time);
   }
   
@@ -450,7 +450,7 @@ public:
   virtual void run() {
     // send
     if (this->in.isConnected()) {
-      sendData[0] = this->in.getSignal().getValue();
+      sendData[0] = this->in.getSignalFast().getValue();
       if (isServer) server->setSendBuffer(sendData);
       else client->setSendBuffer(sendData);
     }
@@ -500,7 +500,7 @@ public:
     }
             
     this->out.getSignal().setValue(output);
-    timestamp_t time = System::getTimeNs();
+    timestamp_t time = this->getTimestamp();
     this->out.getSignal().setTimestamp(time);
   }
   
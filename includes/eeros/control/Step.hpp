@@ -61,7 +61,7 @@ class Step : public Blockio<0,1,T> {
       this->out.getSignal().setValue(initValue + stepHeight);
       stepDone = true;
     }
-    this->out.getSignal().setTimestamp(System::getTimeNs());
+    this->out.getSignal().setTimestamp(this->getTimestamp());
   }
   
   /**
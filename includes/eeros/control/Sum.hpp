@@ -45,19 +45,19 @@ class Sum : public Blockio<N,1,T> {
       for (uint8_t i = 0; i < N; i++) {
         T val;
         if (init[i]) val = initVal[i];
-        else val = this->in[i].getSignal().getValue();
+        else val = this->in[i].getSignalFast().getValue();
         if (negated[i]) sum -= val;
         else sum += val;
       }
       first = false;
     } else {
       for (uint8_t i = 0; i < N; i++) {
-        if (negated[i]) sum -= this->in[i].getSignal().getValue();
-        else sum += this->in[i].getSignal().getValue();
+        if (negated[i]) sum -= this->in[i].getSignalFast().getValue();
+        else sum += this->in[i].getSignalFast().getValue();
       }
     }
     this->out.getSignal().setValue(sum);
-    this->out.getSignal().setTimestamp(this->in[0].getSignal().getTimestamp());
+    this->out.getSignal().setTimestamp(this->in[0].getSignalFast().getTimestamp());
   }
   
   /**
@@ -6,7 +6,8 @@
 #include <eeros/safety/SafetyLevel.hpp>
 #include <eeros/safety/SafetySystem.hpp>
 #include <eeros/logger/Logger.hpp>
-#include <mutex>
+#include <eeros/core/ParameterSet.hpp>
+#include <atomic>
 
 namespace eeros {
 namespace control {
@@ -17,6 +18,8 @@ namespace control {
  * to a predefined position and a safety event can be triggered. The switch can be made to switch
  * only if the current safety level is greater or the same as the active level set on this switch.
  * Two or more switches can be combined. This mechanism allows to switch them simultaneously.
+ * The switching condition and safety settings are published to the thread running the block
+ * without locking it, see \ref ParameterSet.
  * 
  * @tparam N - number of inputs
  * @tparam T - value type (double - default type)
@@ -40,9 +43,6 @@ class Switch : public Blockio<N,1,T> {
    */
   Switch(uint8_t initInputIndex) 
       : currentInput(initInputIndex),
-        safetySystem(nullptr),
-        safetyEvent(nullptr),
-        activeLevel(nullptr),
         log(logger::Logger::getLogger()) { }
 
   /**
@@ -54,26 +54,28 @@ class Switch : public Blockio<N,1,T> {
   * Runs the switch block.
   */
   virtual void run() override {
-    std::lock_guard<std::mutex> lock(mtx);
-    auto val = this->in[currentInput].getSignal().getValue();
+    const Parameters& p = params.read();
+    uint8_t input = currentInput;
+    auto val = this->in[input].getSignal().getValue();
     if (armed && !switched) {
-      if (val < (switchLevel + delta) && val > (switchLevel - delta)) {
-        if (activeLevel == nullptr ||
-           (activeLevel != nullptr && safetySystem->getCurrentLevel() >= *activeLevel)
+      if (val < (p.switchLevel + p.delta) && val > (p.switchLevel - p.delta)) {
+        if (p.activeLevel == nullptr ||
+           (p.activeLevel != nullptr && p.safetySystem->getCurrentLevel() >= *p.activeLevel)
            ) {
           log.warn() << "Switch \'" + this->getName() + "\' switches!";
-          switchToInput(nextInput);
-          for(Switch* i : c) i->switchToInput(nextInput);
+          switchToInput(p.nextInput);
+          for(Switch* i : c) i->switchToInput(p.nextInput);
           switched = true;
           armed = false;
-          if (safetySystem != nullptr && safetyEvent != nullptr) {
-            safetySystem->triggerEvent(*safetyEvent);
+          if (p.safetySystem != nullptr && p.safetyEvent != nullptr) {
+            p.safetySystem->triggerEvent(*p.safetyEvent);
           }
         }
       }
     }
-    this->out.getSignal().setValue(this->in[currentInput].getSignal().getValue());
-    this->out.getSignal().setTimestamp(this->in[currentInput].getSignal().getTimestamp());
+    input = currentInput;
+    this->out.getSignal().setValue(this->in[input].getSignal().getValue());
+    this->out.getSignal().setTimestamp(this->in[input].getSignal().getTimestamp());
   }
                   
   /**
@@ -109,8 +111,10 @@ class Switch : public Blockio<N,1,T> {
   * @param e - safety event
   */
   virtual void registerSafetyEvent(safety::SafetySystem& ss, safety::SafetyEvent& e) {
-    safetySystem = &ss;
-    safetyEvent = &e;
+    params.update([&](Parameters& p) {
+      p.safetySystem = &ss;
+      p.safetyEvent = &e;
+    });
   }
 
   /**
@@ -123,9 +127,10 @@ class Switch : public Blockio<N,1,T> {
    * @param level - SafetyLevel
    */
   virtual void setActiveLevel(safety::SafetySystem& ss, safety::SafetyLevel &level) {
-    std::lock_guard<std::mutex> lock(mtx);
-    safetySystem = &ss;
-    activeLevel = &level;
+    params.update([&](Parameters& p) {
+      p.safetySystem = &ss;
+      p.activeLevel = &level;
+    });
   }
 
   /**
@@ -141,9 +146,11 @@ class Switch : public Blockio<N,1,T> {
   * @param index - position to switch to 
   */
   virtual void setCondition(T switchLevel, T delta, uint8_t index) {
-    this->switchLevel = switchLevel;
-    this->delta = delta;
-    nextInput = index;
+    params.update([&](Parameters& p) {
+      p.switchLevel = switchLevel;
+      p.delta = delta;
+      p.nextInput = index;
+    });
   }
                   
   /**
@@ -178,16 +185,20 @@ class Switch : public Blockio<N,1,T> {
   }
 
  protected:
-  uint8_t currentInput, nextInput;
-  T switchLevel, delta;
-  bool armed = false;
-  bool switched = false;
-  safety::SafetySystem* safetySystem;
-  safety::SafetyEvent* safetyEvent;
-  safety::SafetyLevel *activeLevel;
+  struct Parameters {
+    uint8_t nextInput{0};
+    T switchLevel, delta;
+    safety::SafetySystem* safetySystem{nullptr};
+    safety::SafetyEvent* safetyEvent{nullptr};
+    safety::SafetyLevel *activeLevel{nullptr};
+  };
+
+  std::atomic<uint8_t> currentInput;
+  std::atomic<bool> armed{false};
+  std::atomic<bool> switched{false};
+  ParameterSet<Parameters> params;
   std::vector<Switch*> c;
   eeros::logger::Logger log;
-  std::mutex mtx{};
 };
 
 /********** Print functions **********/
@@ -2,24 +2,38 @@
 #define ORG_EEROS_CONTROLTIMEDOMAIN_HPP
 
 #include <list>
+#include <vector>
 #include <string>
+#include <memory>
+#include <atomic>
+#include <exception>
+#include <eeros/types.hpp>
 #include <eeros/core/Runnable.hpp>
+#include <eeros/core/SpinBarrier.hpp>
+#include <eeros/core/Statistics.hpp>
+#include <eeros/core/Histogram.hpp>
+#include <eeros/logger/Logger.hpp>
 #include <eeros/control/NotConnectedFault.hpp>
 #include <eeros/control/NaNOutputFault.hpp>
 #include <eeros/safety/SafetySystem.hpp>
 #include <eeros/safety/SafetyLevel.hpp>
 
 namespace eeros {
+namespace task {
+class Async;
+}
 namespace control {
 
 using namespace safety;
 
 /**
  * A timedomain is responsible for running the blocks which were added to it.
- * Blocks can be freely added and removed. A removed block will no longer be
- * run. A timedomain must be assigned a period. As soon as the timedomain is 
- * added to the executor, the executor will run the timedomain with the assigned 
- * period. You can stop the executor running the timedomain and restart it later.
+ * Blocks can be added and removed while the timedomain is stopped, they must be 
+ * sorted again before it runs. A removed block will no longer be run. A timedomain 
+ * must be assigned a period. As soon as the timedomain is added to the executor, 
+ * the executor will run the timedomain with the assigned period. You can stop the 
+ * executor running the timedomain and restart it later.
+ * Blocks run in the order of their connections, see \ref sortBlocks.
  * 
  * @since v0.4
  */
@@ -34,6 +48,11 @@ class TimeDomain : public virtual Runnable {
    * @param realtime - when true, executor creates a realtime thread if available by the system 
    */
   TimeDomain(std::string name, double period, bool realtime);
+
+  /**
+   * Destructs a timedomain and stops its worker threads.
+   */
+  virtual ~TimeDomain();
   
   /**
    * Adds a block to a time domain.
@@ -93,6 +112,161 @@ class TimeDomain : public virtual Runnable {
    */
   void registerSafetyEvent(SafetySystem& ss, SafetyEvent& e);
 
+  /**
+   * Orders the blocks such that every block runs after the blocks its inputs are 
+   * connected to, so it reads the values of the current cycle. Blocks without such a 
+   * dependency keep the order in which they were added. Runnables which are not blocks 
+   * keep their position, blocks are only reordered between them. Blocks forming a loop 
+   * keep their order, the first block of the loop reads the values of the previous 
+   * cycle. Reordered blocks and all connections read with a delay of one cycle are logged.
+   * Sorting allocates memory and logs, so it is a setup step which never happens in 
+   * \ref run. The executor sorts all its timedomains before it starts. Call it yourself 
+   * if the timedomain is run otherwise and again after adding or removing blocks or 
+   * changing connections. Unsorted blocks run sequentially in the order they were 
+   * added and a warning is logged once.
+   *
+   * @return number of connections which are read with a delay of one cycle
+   */
+  std::size_t sortBlocks();
+
+  /**
+   * Freezes the inputs of all blocks, see \ref Input::freeze. Blocks then read 
+   * their inputs through a cached pointer instead of resolving the connection 
+   * on every read. Call it after all connections are made.
+   *
+   * @return true, if all inputs are connected and frozen
+   */
+  bool freeze();
+
+  /**
+   * Unfreezes the inputs of all blocks, e.g. before changing connections.
+   */
+  void unfreeze();
+
+  /**
+   * Checks the connections of all blocks before the timedomain is run. The executor 
+   * validates all its timedomains when it starts, see \ref Executor::run. Every 
+   * unconnected input and every block which was added more than once is logged, 
+   * not only the first one. All connected inputs are frozen, see \ref freeze, and 
+   * blocks read them without any connection check. Unconnected inputs are not an 
+   * error by themselves, some blocks read an input only if it is connected. Such 
+   * inputs keep checking their connection and reading them throws a 
+   * \ref NotConnectedFault as before. Adding or removing blocks afterwards requires 
+   * to validate again.
+   *
+   * @return number of problems found, 0 if the timedomain is valid
+   */
+  std::size_t validate();
+
+  /**
+   * Queries whether the timedomain was validated since blocks were last added or removed.
+   *
+   * @return true, if validated
+   */
+  bool isValidated() const;
+
+  /**
+   * Runs the blocks on several threads. The sorted blocks are split into stages, 
+   * a block runs in a later stage than all blocks it is connected to and which 
+   * run before it, see \ref sortBlocks. The blocks of a stage run in parallel, 
+   * distributed over the threads in a fixed way, and all threads wait for each 
+   * other with a \ref SpinBarrier before the next stage. Therefore every block 
+   * reads the same values as in the sequential order. Blocks must only exchange 
+   * data through their connections. Runnables which are not blocks run alone 
+   * on the thread running the timedomain.
+   * 
+   * Worker threads are created immediately, call it before the timedomain runs. 
+   * They are realtime threads if the timedomain is realtime. For short cycles, pin 
+   * them to CPUs which are otherwise idle, as they busy wait between stages. Every 
+   * worker needs a CPU of its own: a realtime thread waiting at the barrier does 
+   * not let a thread with a lower priority on the same CPU run, so the cycle would 
+   * stall. Therefore a list of CPUs with duplicates or with fewer CPUs than worker 
+   * threads is rejected, and so is an empty list for a realtime timedomain. Also 
+   * keep the thread running the timedomain off these CPUs.
+   *
+   * @param threads - number of threads including the thread running the timedomain, 
+   *                  0 or 1 to run the blocks sequentially
+   * @param cpus - distinct CPUs the worker threads are pinned to, worker i runs on CPU cpus[i - 1], 
+   *               empty to leave the placement to the scheduler (not realtime timedomains only)
+   * @param nice - nice level of the worker threads, see \ref Executor::set_priority
+   */
+  void setParallel(unsigned threads, std::vector<int> cpus = {}, int nice = 0);
+
+  /**
+   * Gets the number of threads running the blocks.
+   *
+   * @return number of threads, 1 if sequential
+   */
+  unsigned getParallel() const;
+
+  /**
+   * Gets the number of stages the blocks are split into if run in parallel.
+   *
+   * @return number of stages, 0 if sequential
+   */
+  std::size_t getStageCount();
+
+  /**
+   * Gets the start time of the last cycle. All blocks of a cycle stamp their 
+   * outputs with this time unless they read the clock themselves, see 
+   * \ref CycleContext and \ref Block::setAcquisitionTimestamps.
+   *
+   * @return time in ns, 0 if the timedomain did not run yet
+   */
+  timestamp_t getCycleTime() const;
+
+  /**
+   * Run time of a single block recorded by the profiler.
+   */
+  struct BlockProfile {
+    Runnable* block;
+    std::string name;
+    Statistics run;
+    Histogram histogram;
+  };
+
+  /**
+   * Records the run time of every block in each cycle, see \ref reportProfile. 
+   * Measuring costs two reads of the monotonic clock per block. The statistics 
+   * are always allocated when the blocks are sorted, so profiling can be switched 
+   * on and off while the timedomain runs.
+   *
+   * @param value - true, to record the run time of each block
+   */
+  void setProfiling(bool value);
+
+  /**
+   * Gets the profiling flag.
+   *
+   * @return true, if the run time of each block is recorded
+   */
+  bool getProfiling() const;
+
+  /**
+   * Clears the recorded run times. Call it while the timedomain is not running.
+   */
+  void resetProfile();
+
+  /**
+   * Gets the recorded run times of all blocks ranked by their mean or their 
+   * maximum run time, the most expensive block first. The run times are read 
+   * without locking, read them while the timedomain is stopped, e.g. after the 
+   * executor returned, to get consistent values.
+   *
+   * @param byWorstCase - if true, rank by maximum instead of mean run time
+   * @return run times of the blocks
+   */
+  std::vector<const BlockProfile*> getProfile(bool byWorstCase = false);
+
+  /**
+   * Logs the most expensive blocks ranked by their mean and by their maximum run time.
+   * Read them while the timedomain is stopped, see \ref getProfile.
+   *
+   * @param log - logger
+   * @param count - number of blocks listed per ranking, 0 for all
+   */
+  void reportProfile(logger::Logger &log, std::size_t count = 10);
+
   /**
    * The basic algorithm of the timedomain. It will run all blocks.
    */
@@ -121,10 +295,34 @@ class TimeDomain : public virtual Runnable {
   
  private:
   std::string name;
+  const char* traceName;
   double period;
   bool realtime;
   bool running = true;
+  timestamp_t cycleTime = 0;
   std::list<Runnable*> blocks;
+  std::vector<Runnable*> schedule;
+  bool sorted = false;
+  bool unsortedWarned = false;
+  bool validated = false;
+
+  struct Stage {
+    std::vector<std::vector<std::size_t>> parts;   // positions in the schedule per thread
+  };
+  class Worker;
+  void runBlock(std::size_t i);
+  void partition();
+  void runStages(unsigned thread);
+  void runParallel();
+  void stopWorkers();
+  std::vector<Stage> stages;
+  std::unique_ptr<SpinBarrier> barrier;
+  std::vector<std::unique_ptr<Worker>> workers;
+  std::vector<std::unique_ptr<task::Async>> workerThreads;
+  std::vector<std::exception_ptr> errors;
+  std::atomic<bool> failed{false};
+  std::atomic<bool> profiling{false};
+  std::vector<BlockProfile> profiles;
   SafetySystem* safetySystem;
   SafetyEvent* safetyEvent;
 };
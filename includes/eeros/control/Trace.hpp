@@ -2,11 +2,23 @@
 #define ORG_EEROS_CONTROL_TRACE_HPP_
 
 #include <vector>
+#include <algorithm>
 #include <iostream>
 #include <fstream>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <type_traits>
 #include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
 #include <eeros/control/Blockio.hpp>
 #include <eeros/core/Thread.hpp>
+#include <eeros/core/Fault.hpp>
+#include <eeros/core/SpscRingBuffer.hpp>
 #include <eeros/logger/Logger.hpp>
 
 #include <time.h>
@@ -37,8 +49,8 @@ class Trace : public Blockio<1,0,T> {
 
   virtual void run() {
     if (running) {
-      buf[index] = this->in.getSignal().getValue();
-      timeBuf[index] = this->in.getSignal().getTimestamp();
+      buf[index] = this->in.getSignalFast().getValue();
+      timeBuf[index] = this->in.getSignalFast().getTimestamp();
       index++;
       if (index == maxBufLen) {
         index = 0;
@@ -128,8 +140,10 @@ private:
       timestamp_t* timeStampBuf = trace.getTimestampTrace();
       T* buf = trace.getTrace();
       file << "name = " << trace.getName() << ", size = " << trace.getSize() << ", maxBufLen = " << trace.maxBufLen << "\n";
-      for (uint32_t i = 0; i < trace.getSize(); i++) file << timeStampBuf[i] << " " << buf[i] << std::endl;
+      for (uint32_t i = 0; i < trace.getSize(); i++) file << timeStampBuf[i] << " " << buf[i] << '\n';
       file.close();
+      delete[] timeStampBuf;
+      delete[] buf;
       log.info() << "trace file written";
     }
   }
@@ -138,6 +152,251 @@ private:
   logger::Logger log;
 };
 
+/**
+ * A streaming trace records its input signal to a file without a length limit,
+ * e.g. for recordings over hours. The block appends each value with its timestamp
+ * to a preallocated \ref SpscRingBuffer, it never locks, allocates or waits.
+ * A non realtime writer thread drains the buffer periodically and writes the
+ * records to a compact binary file in large chunks. If the writer falls behind
+ * so far that the buffer is full, records are dropped and counted, see \ref getDropped.
+ * After the first error writing the file, the trace stops writing and drops all
+ * further records; the file is cut after the last complete record.
+ *
+ * The file starts with a header: the 8 characters "EEROSTRC", the format version,
+ * the size of a value in bytes and the length of the name of the block as 32 bit
+ * integers, followed by the name. Each record consists of a 64 bit timestamp followed
+ * by the bytes of the value. All numbers are stored in the byte order of the machine.
+ * Use \ref load to read such a file.
+ *
+ * @tparam T - signal type, must be trivially copyable (double - default type)
+ *
+ * @since v1.4
+ */
+template < typename T = double >
+class TraceStream : public Blockio<1,0,T> {
+  static_assert(std::is_trivially_copyable<T>::value, "A streaming trace stores the bytes of its values, they must be trivially copyable!");
+ public:
+  static constexpr uint32_t version = 1;
+  static constexpr std::size_t recordSize = sizeof(timestamp_t) + sizeof(T);
+
+  /**
+   * Constructs a streaming trace and allocates its buffer.
+   *
+   * @param bufLen - number of records the buffer holds, choose it to last for some flush periods
+   */
+  TraceStream(uint32_t bufLen = 65536) : buf(bufLen), dropped(0), written(0), log(logger::Logger::getLogger()) { }
+
+  /**
+  * Disabling use of copy constructor because the block should never be copied unintentionally.
+  */
+  TraceStream(const TraceStream& s) = delete;
+
+  /**
+   * Destructor stops recording and closes the file.
+   */
+  ~TraceStream() {
+    stop();
+  }
+
+  virtual void run() {
+    if (!recording.load(std::memory_order_relaxed)) return;
+    auto& sig = this->in.getSignalFast();
+    if (!buf.push({sig.getTimestamp(), sig.getValue()})) dropped.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /**
+   * Opens the trace file, starts the writer thread and starts recording.
+   * Records which were left in the buffer from a previous recording are discarded.
+   *
+   * @param fileName - name of the trace file, an existing file is overwritten
+   * @param flushPeriod - period in sec with which the buffer is drained
+   * @param chunkSize - number of bytes collected before they are written to the file
+   */
+  void start(const std::string& fileName, double flushPeriod = 0.01, std::size_t chunkSize = 1 << 20) {
+    if (fd >= 0) throw Fault("trace '" + this->getName() + "' already started");
+    fd = ::open(fileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) throw Fault("could not open trace file " + fileName);
+    Record r;
+    while (buf.pop(r));
+    std::string name = this->getName();
+    uint32_t header[3] = {version, static_cast<uint32_t>(sizeof(T)), static_cast<uint32_t>(name.size())};
+    // the whole header goes into the first chunk
+    chunk.resize(std::max({chunkSize, recordSize, 8 + sizeof(header) + name.size()}));
+    fill = 0;
+    headerFill = 0;
+    pending = 0;
+    fileSize = 0;
+    failed = false;
+    dropped = 0;
+    written = 0;
+    append("EEROSTRC", 8);
+    append(header, sizeof(header));
+    append(name.data(), name.size());
+    headerFill = fill;
+    writing = true;
+    writer = std::thread(&TraceStream::writeLoop, this, flushPeriod);
+    recording = true;
+  }
+
+  /**
+   * Stops recording, writes the remaining records and closes the trace file.
+   */
+  void stop() {
+    recording = false;
+    {
+      std::lock_guard<std::mutex> lock(mtx);
+      writing = false;
+    }
+    cv.notify_one();
+    if (writer.joinable()) writer.join();
+    if (fd < 0) return;
+    drain();
+    writeChunk();
+    ::close(fd);
+    fd = -1;
+  }
+
+  /**
+   * Checks whether the trace records.
+   *
+   * @return true, if recording
+   */
+  bool isRecording() const {
+    return recording.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Gets the number of records dropped because the buffer was full or writing 
+   * to the file failed.
+   *
+   * @return dropped records
+   */
+  uint64_t getDropped() const {
+    return dropped.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Gets the number of records written to the file so far.
+   *
+   * @return written records
+   */
+  uint64_t getWritten() const {
+    return written.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Reads a trace file written by a streaming trace.
+   *
+   * @param fileName - name of the trace file
+   * @param time - receives the timestamps
+   * @param value - receives the values
+   * @return name of the traced block
+   */
+  static std::string load(const std::string& fileName, std::vector<timestamp_t>& time, std::vector<T>& value) {
+    std::ifstream file(fileName, std::ios::binary);
+    char magic[8];
+    uint32_t header[3];
+    if (!file.read(magic, sizeof(magic)) || std::string(magic, sizeof(magic)) != "EEROSTRC" || !file.read(reinterpret_cast<char*>(header), sizeof(header)))
+      throw Fault("'" + fileName + "' is not a trace file");
+    if (header[0] != version || header[1] != sizeof(T)) throw Fault("trace file '" + fileName + "' does not match the value type");
+    std::string name(header[2], '\0');
+    if (!file.read(&name[0], header[2])) throw Fault("trace file '" + fileName + "' is truncated");
+    time.clear();
+    value.clear();
+    timestamp_t t;
+    T v;
+    while (file.read(reinterpret_cast<char*>(&t), sizeof(t)) && file.read(reinterpret_cast<char*>(&v), sizeof(v))) {
+      time.push_back(t);
+      value.push_back(v);
+    }
+    return name;
+  }
+
+ private:
+  struct Record {
+    timestamp_t timestamp;
+    T value;
+  };
+
+  void writeLoop(double flushPeriod) {
+    auto period = std::chrono::duration<double>(flushPeriod);
+    std::unique_lock<std::mutex> lock(mtx);
+    while (writing) {
+      cv.wait_for(lock, period, [this]() { return !writing; });
+      drain();
+    }
+  }
+
+  // moves all buffered records into the chunk, writes full chunks
+  void drain() {
+    Record r;
+    while (buf.pop(r)) {
+      if (fill + recordSize > chunk.size()) writeChunk();
+      append(&r.timestamp, sizeof(r.timestamp));
+      append(&r.value, sizeof(r.value));
+      pending++;
+    }
+  }
+
+  void append(const void* data, std::size_t size) {
+    if (fill + size > chunk.size()) writeChunk();
+    if (size > chunk.size()) chunk.resize(size);
+    std::memcpy(&chunk[fill], data, size);
+    fill += size;
+  }
+
+  void writeChunk() {
+    std::size_t done = 0;
+    while (!failed && done < fill) {
+      ssize_t n = ::write(fd, &chunk[done], fill - done);
+      if (n >= 0) {
+        done += n;
+      }
+      else if (errno != EINTR) {
+        // later chunks would not line up with the records, so stop for good 
+        // and cut a partially written record or header
+        log.error() << "trace '" << this->getName() << "' could not write to its file, dropping further records: " << strerror(errno);
+        failed = true;
+        std::size_t valid = done < headerFill ? 0 : done - (done - headerFill) % recordSize;
+        if (::ftruncate(fd, fileSize + valid) != 0)
+          log.warn() << "trace '" << this->getName() << "' could not cut its file after the last complete record: " << strerror(errno);
+      }
+    }
+    fileSize += done;
+    // only records which reached the file count as written
+    uint64_t complete = done > headerFill ? (done - headerFill) / recordSize : 0;
+    written.fetch_add(complete, std::memory_order_relaxed);
+    dropped.fetch_add(pending - complete, std::memory_order_relaxed);
+    fill = 0;
+    headerFill = 0;
+    pending = 0;
+  }
+
+  SpscRingBuffer<Record> buf;
+  std::vector<char> chunk;
+  std::size_t fill = 0;
+  std::size_t headerFill = 0;   // bytes of the file header at the start of the chunk
+  uint64_t pending = 0;         // records in the chunk
+  std::size_t fileSize = 0;     // bytes written to the file
+  bool failed = false;          // set upon the first write error
+  int fd = -1;
+  std::atomic<bool> recording{false};
+  std::atomic<uint64_t> dropped;
+  std::atomic<uint64_t> written;
+  bool writing = false;
+  std::mutex mtx;
+  std::condition_variable cv;
+  logger::Logger log;
+  std::thread writer;
+};
+
+/********** Print functions **********/
+template <typename T>
+std::ostream& operator<<(std::ostream& os, TraceStream<T>& trace) {
+  os << "Block trace stream: '" << trace.getName() << "'";
+  return os;
+}
+
 };
 };
 
@@ -1,8 +1,13 @@
 #ifndef ORG_EEROS_CONTROL_TRANSITION_HPP_
 #define ORG_EEROS_CONTROL_TRANSITION_HPP_
 
-#include <mutex>
 #include <eeros/control/Blockio.hpp>
+#include <eeros/core/TripleBuffer.hpp>
+#include <eeros/core/SpscRingBuffer.hpp>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <type_traits>
 #include <iostream>
 
 namespace eeros {
@@ -12,12 +17,18 @@ template < typename T > class TransitionInBlock;
 template < typename T > class TransitionOutBlock;
 
 /**
- * A transition block serves to bring a signal from one timedomain to another. 
- * It consists of two separate blocks, each of them running in one of the 
+ * A transition block serves to bring a signal from one timedomain to another.
+ * It consists of two separate blocks, each of them running in one of the
  * two timedomains which the transition block connects.
  * You have to add the inBlock of this transition block to one timedomain
  * and the outBlock to the second timedomain.
  *
+ * The two blocks never lock and never allocate while running, neither timedomain
+ * waits for the other. Latest values are handed over with a \ref TripleBuffer,
+ * from a fast to a slow timedomain all values are queued in a preallocated
+ * \ref SpscRingBuffer. If the slow timedomain falls behind so far that the buffer
+ * is full, further values are dropped and counted, see \ref getOverruns.
+ *
  * @tparam T - signal type (double - default type)
  *
  * @since v1.0
@@ -35,124 +46,204 @@ class Transition {
    * or from fast to slow timedomain (ratio < 1).
    * For ratio > 1, the transition block usually interpolates. For ratio < 1 the transition
    * block usually filters. If no interpolation or filtering is desired, you can set steady to true.
+   * From fast to slow, the buffer holds twice the values expected per slow cycle,
+   * but at least 16 values, unless a capacity is given.
    *
    * @param ratio - ratio
    * @param steady - true if no interpolation or filtering should happen
+   * @param capacity - number of values buffered from fast to slow timedomain, 0 to derive it from the ratio
    */
-  Transition(double ratio, bool steady = false) : inBlock(*this), outBlock(*this), steady(steady), ratio(ratio) {
+  Transition(double ratio, bool steady = false, std::size_t capacity = 0)
+      : inBlock(*this), outBlock(*this), latest({cleared(), cleared()}), steady(steady), ratio(ratio), 
+        buf(bufferSize(ratio, steady, capacity)), overruns(0) {
     if (ratio >= 1.0) {	// slow to fast time domain
       inBlock.up = true;
       outBlock.up = true;
-      refresh = false;
-      in.clear(); 
-      prevIn.clear();
     } else {	// fast to slow time domain
       inBlock.up = false;
       outBlock.up = false;
-      bufSize = 1 / ratio;
     }
   }
 
   /**
    * Disabling use of copy constructor because the block should never be copied unintentionally.
    */
-  Transition(const Transition& s) = delete; 
+  Transition(const Transition& s) = delete;
+
+  /**
+   * Lets the inBlock pass on only every n-th value from a fast to a slow timedomain.
+   * This reduces the values the outBlock has to process. Set it before the
+   * timedomains run.
+   *
+   * @param n - decimation factor, 1 passes all values
+   */
+  void setDecimation(uint32_t n) {
+    decimation = n > 0 ? n : 1;
+  }
+
+  /**
+   * Makes the outBlock deliver the mean of all values received since its last run
+   * instead of a single value, if the transfer happens from a fast to a slow timedomain.
+   * The timestamp is the middle between the first and the last value. Without averaging,
+   * the outBlock delivers the last value older than the signal at its input.
+   * Set it before the timedomains run.
+   *
+   * @param value - true, to average the values
+   */
+  void setAveraging(bool value) {
+    averaging = value;
+  }
+
+  /**
+   * Gets the number of values dropped because the buffer from a fast to a slow
+   * timedomain was full.
+   *
+   * @return number of dropped values
+   */
+  uint64_t getOverruns() const {
+    return overruns.load(std::memory_order_relaxed);
+  }
 
   /** The block running in the timedomain from which the signal originates */
   TransitionInBlock<T> inBlock;
   /** The block running in the timedomain to which the signal has to be delivered */
   TransitionOutBlock<T> outBlock;
-  
- private: 
-  std::vector<Signal<T>> buf;
-  Signal<T> in, prevIn;
-  bool refresh;
+
+ private:
+  struct Sample {
+    T value;
+    timestamp_t timestamp;
+  };
+  struct Pair {
+    Sample prev, in;
+  };
+
+  static Sample cleared() {
+    Sample s;
+    clear<T>(s.value);
+    s.timestamp = 0;
+    return s;
+  }
+
+  template <typename S> static typename std::enable_if<std::is_arithmetic<S>::value>::type clear(S& v) {
+    v = std::numeric_limits<S>::has_quiet_NaN ? std::numeric_limits<S>::quiet_NaN() : std::numeric_limits<S>::min();
+  }
+
+  template <typename S> static typename std::enable_if<std::is_compound<S>::value>::type clear(S& v) {
+    using V = typename S::value_type;
+    v.fill(std::numeric_limits<V>::has_quiet_NaN ? std::numeric_limits<V>::quiet_NaN() : std::numeric_limits<V>::min());
+  }
+
+  static std::size_t bufferSize(double ratio, bool steady, std::size_t capacity) {
+    if (ratio >= 1.0 || steady) return 1;
+    if (capacity > 0) return capacity;
+    double n = 2 * std::ceil(1 / ratio);
+    return (ratio > 0 && n > 16) ? static_cast<std::size_t>(n) : 16;
+  }
+
+  TripleBuffer<Pair> latest;
   bool steady;
   double ratio;
-  uint32_t bufSize;
-  std::mutex mtx;
+  uint32_t decimation = 1;
+  bool averaging = false;
+  SpscRingBuffer<Sample> buf;
+  std::atomic<uint64_t> overruns;
 };
 
 template < typename T = double >
 class TransitionInBlock : public Blockio<1,0,T> {
   friend class Transition<T>;
  public:
-  TransitionInBlock(Transition<T>& c) : container(c) { }
-  
-  virtual void run() { 
-    if (container.steady) {
-      container.mtx.lock();
-      container.in = this->getIn().getSignal(); 
-      container.mtx.unlock();
-    } else {
-      if (up) {	// up
-        container.mtx.lock();
-        container.prevIn = container.in;
-        container.in = this->getIn().getSignal(); 
-        container.refresh = true;
-        container.mtx.unlock();
-      } else {	//down
-        container.mtx.lock();
-        auto val = this->getIn().getSignal(); 
-        container.buf.push_back(val);
-        container.mtx.unlock();
+  TransitionInBlock(Transition<T>& c) : container(c), time(0), count(0) {
+    Transition<T>::template clear<T>(value);
+  }
+
+  virtual void run() {
+    auto& sig = this->getIn().getSignal();
+    if (container.steady || up) {
+      // publish the latest value together with the one before for interpolation
+      auto& pair = container.latest.writeBuffer();
+      pair.prev.value = value;
+      pair.prev.timestamp = time;
+      value = sig.getValue();
+      time = sig.getTimestamp();
+      pair.in.value = value;
+      pair.in.timestamp = time;
+      container.latest.publish();
+    } else {	// down
+      if (count++ % container.decimation != 0) return;
+      if (!container.buf.push({sig.getValue(), sig.getTimestamp()})) {
+        container.overruns.fetch_add(1, std::memory_order_relaxed);
       }
     }
   }
-  
+
  protected:
   bool up;
   Transition<T>& container;
+  T value;
+  timestamp_t time;
+  uint32_t count;
 };
 
 template < typename T = double >
 class TransitionOutBlock : public Blockio<1,1,T> {
   friend class Transition<T>;
  public:
-  TransitionOutBlock(Transition<T>& c) : container(c), count(0) {in.clear(); prevIn.clear();}
-  
-  virtual void run() { 
+  TransitionOutBlock(Transition<T>& c) : container(c), count(0) {
+    Transition<T>::template clear<T>(dVal);
+    dTime = 0;
+  }
+
+  virtual void run() {
     if (container.steady) {
-      container.mtx.lock();
-      this->getOut().getSignal().setValue(container.in.getValue()); 
-      this->getOut().getSignal().setTimestamp(container.in.getTimestamp());
-      container.mtx.unlock();
+      auto& in = container.latest.read().in;
+      this->getOut().getSignal().setValue(in.value);
+      this->getOut().getSignal().setTimestamp(in.timestamp);
     } else {
       if (up) {	// up
-        if (container.refresh) {
-          container.mtx.lock();
-          prevIn = container.prevIn;
-          in = container.in;
-          container.refresh = false;
-          container.mtx.unlock();
+        if (container.latest.acquire()) {
+          auto& pair = container.latest.current();
           count = 0;
-          dVal = (in.getValue() - prevIn.getValue()) / container.ratio;
-          dTime= (in.getTimestamp() - prevIn.getTimestamp()) / container.ratio;
+          dVal = (pair.in.value - pair.prev.value) / container.ratio;
+          dTime= (pair.in.timestamp - pair.prev.timestamp) / container.ratio;
         }
-        T val = prevIn.getValue() + dVal * count;
+        auto& prevIn = container.latest.current().prev;
+        T val = prevIn.value + dVal * count;
         this->getOut().getSignal().setValue(val);
-        timestamp_t time = prevIn.getTimestamp() + count * dTime;
+        timestamp_t time = prevIn.timestamp + count * dTime;
         this->getOut().getSignal().setTimestamp(time);
         count++;
       } else {	//down
-        auto time = this->getIn().getSignal().getTimestamp();
-        container.mtx.lock();
-        std::size_t i = 0;
-        while (i < container.buf.size() && time > container.buf[i].getTimestamp()) i++;
-        if (i > 0) i--;
-        Signal<T> sig = container.buf[i];
-        container.buf.clear();
-        container.mtx.unlock();
-        this->getOut().getSignal().setValue(sig.getValue());
-        this->getOut().getSignal().setTimestamp(sig.getTimestamp());
+        typename Transition<T>::Sample s, sig;
+        if (!container.buf.pop(sig)) return;	// nothing new, keep the last value
+        if (container.averaging) {
+          T sum = sig.value;
+          timestamp_t first = sig.timestamp, last = sig.timestamp;
+          uint32_t n = 1;
+          while (container.buf.pop(s)) {
+            sum = sum + s.value;
+            last = s.timestamp;
+            n++;
+          }
+          sig.value = sum / static_cast<double>(n);
+          sig.timestamp = first + (last - first) / 2;
+        } else {
+          // the last value older than the reference time, or the first one if there is none
+          auto time = this->getIn().getSignal().getTimestamp();
+          while (container.buf.pop(s)) {
+            if (time > s.timestamp) sig = s;
+          }
+        }
+        this->getOut().getSignal().setValue(sig.value);
+        this->getOut().getSignal().setTimestamp(sig.timestamp);
       }
     }
   }
-  
+
  protected:
   bool up;
   Transition<T>& container;
-  Signal<T> prevIn, in;
   T dVal;
   double dTime;
   uint32_t count;
@@ -165,7 +256,7 @@ class TransitionOutBlock : public Blockio<1,1,T> {
  */
 template <typename T>
 std::ostream& operator<<(std::ostream& os, Transition<T>& t) {
-  os << "Block transition: '" << t.getName() << "'"; 
+  os << "Block transition: '" << t.getName() << "'";
         return os;
 }
 
@@ -59,7 +59,7 @@ class ZTransferFunction: public Blockio<1,1> {
     }
     
     virtual void run() {
-      last_in[0] = in.getSignal().getValue();
+      last_in[0] = in.getSignalFast().getValue();
       last_out[0] = last_in[0] * fraction.numerator.c[0];
       for (int i = 1; i < N; i++) {
         last_out[0] += (last_in[i] * fraction.numerator.c[i] - last_out[i] * fraction.denominator.c[i]);
@@ -67,7 +67,7 @@ class ZTransferFunction: public Blockio<1,1> {
       last_out[0] /= fraction.denominator.c[0];
       
       out.getSignal().setValue(last_out[0]);
-      out.getSignal().setTimestamp(eeros::System::getTimeNs());
+      out.getSignal().setTimestamp(getTimestamp());
       
       for (int i = (N - 1); i >= 0; i--) {
         last_in[i] = last_in[i - 1];
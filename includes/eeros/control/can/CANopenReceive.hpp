@@ -78,7 +78,7 @@ class CANopenReceive : public Blockio<0,N,Matrix<M,1,double>> {
    */
   virtual void run() {
     if (enabled) {
-      uint64_t ts = eeros::System::getTimeNs();
+      uint64_t ts = this->getTimestamp();
       for (uint32_t i = 0; i < nofPDO; i++) {
         // read PDO
         uint8_t node, TPDOnr, buf[8], len;
@@ -216,9 +216,10 @@ class KalmanFilter : public Blockio<0,0>{
         u[i] = inU[i].getSignal().getValue();
     }
     x = Ad * x + Bd * u;
+    timestamp_t time = getTimestamp();
     for (uint8_t i = 0; i < nofStates; i++) {
       out[i].getSignal().setValue(x[i]);
-      out[i].getSignal().setTimestamp(eeros::System::getTimeNs());
+      out[i].getSignal().setTimestamp(time);
     }
     P = Ad * P * Ad.transpose() + GdQGdT;
   }
@@ -228,10 +229,11 @@ class KalmanFilter : public Blockio<0,0>{
    */
   void correction() {
     std::lock_guard<std::mutex> lock(mtx);
+    timestamp_t time = getTimestamp();
     if (first) {
       for (uint8_t i = 0; i < nofStates; i++) {
         out[i].getSignal().setValue(x[i]);
-        out[i].getSignal().setTimestamp(eeros::System::getTimeNs());
+        out[i].getSignal().setTimestamp(time);
       }
       first = false;
     } else {
@@ -249,7 +251,7 @@ class KalmanFilter : public Blockio<0,0>{
       x = x + K * dy;
       for (uint8_t i = 0; i < nofStates; i++) {
         out[i].getSignal().setValue(x[i]);
-        out[i].getSignal().setTimestamp(eeros::System::getTimeNs());
+        out[i].getSignal().setTimestamp(time);
       }
       P = (eye - K * C) * P;
     }
@@ -56,7 +56,7 @@ class LowPassFilter : public Blockio<1,1,T> {
    * Saves output for next run
    */
   virtual void run(){
-    Signal<T> sig = this->in.getSignal(); 
+    const Signal<T>& sig = this->in.getSignalFast(); 
     T valin = sig.getValue();
     T valprev = prev.getValue();
     if (first) {
@@ -63,7 +63,7 @@ class MedianFilter : public Blockio<1,1,Tval> {
     for(size_t i = 0; i < N-1; i++) {
       currentValues[i] = currentValues[i+1];
     }
-    currentValues[N-1] = this->in.getSignal().getValue();
+    currentValues[N-1] = this->in.getSignalFast().getValue();
     if(enabled) {
       Tval temp[N]{};
       std::copy(std::begin(currentValues), std::end(currentValues), std::begin(temp));
@@ -71,9 +71,9 @@ class MedianFilter : public Blockio<1,1,Tval> {
       currentMedianValue = temp[medianIndex];
       this->out.getSignal().setValue(currentMedianValue);
     } else {
-      this->out.getSignal().setValue(this->in.getSignal().getValue());
+      this->out.getSignal().setValue(this->in.getSignalFast().getValue());
     }
-    this->out.getSignal().setTimestamp(this->in.getSignal().getTimestamp());
+    this->out.getSignal().setTimestamp(this->in.getSignalFast().getTimestamp());
   }
 
   /**
@@ -62,7 +62,7 @@ class MovingAverageFilter : public Blockio<1,1,Tval> {
    * @see disable()
    */
   virtual void run() {
-    Tval val = this->in.getSignal().getValue();
+    Tval val = this->in.getSignalFast().getValue();
     Tval result = coefficients[N-1] * val;
     for(size_t i = 0; i < N - 1; i++) {
       previousValues[i] = previousValues[i+1];
@@ -72,9 +72,9 @@ class MovingAverageFilter : public Blockio<1,1,Tval> {
     if(enabled) {
       this->out.getSignal().setValue(result);
     } else {
-      this->out.getSignal().setValue(this->in.getSignal().getValue());
+      this->out.getSignal().setValue(this->in.getSignalFast().getValue());
     }
-    this->out.getSignal().setTimestamp(this->in.getSignal().getTimestamp());
+    this->out.getSignal().setTimestamp(this->in.getSignalFast().getTimestamp());
   }
 
   /**
@@ -0,0 +1,63 @@
+#ifndef ORG_EEROS_CORE_ABSOLUTETIMERSYNC_HPP_
+#define ORG_EEROS_CORE_ABSOLUTETIMERSYNC_HPP_
+
+#include <eeros/core/SyncSource.hpp>
+
+namespace eeros {
+
+/**
+ * Sync source which sleeps with clock_nanosleep until absolute deadlines, 
+ * so no drift accumulates between cycles. This is the default sync source 
+ * of the \ref Executor.
+ * 
+ * @since v1.4
+ */
+class AbsoluteTimerSync : public SyncSource {
+ public:
+  /**
+   * Constructs a timer sync source.
+   * 
+   * @param clock - clock id, e.g. CLOCK_MONOTONIC or CLOCK_REALTIME
+   * @param busyWaitTime - time in sec to busy wait before each deadline
+   */
+  AbsoluteTimerSync(clockid_t clock = CLOCK_MONOTONIC, double busyWaitTime = 0);
+
+  /**
+   * Sets the clock on which the timer waits. CLOCK_MONOTONIC_RAW can't be used, 
+   * as the kernel does not support sleeping on it.
+   *
+   * @param clock - clock id, e.g. CLOCK_MONOTONIC or CLOCK_REALTIME
+   */
+  void setClock(clockid_t clock);
+
+  /**
+   * Enables the hybrid wait mode. The timer sleeps until the given time before 
+   * the deadline and busy waits for the rest. This trades CPU time for lower 
+   * wake-up jitter. A value of 0 disables busy waiting.
+   *
+   * @param busyWaitTime - time in sec to busy wait before each deadline
+   */
+  void setBusyWaitTime(double busyWaitTime);
+
+  /**
+   * Gets the busy wait time.
+   *
+   * @return busy wait time in sec
+   */
+  double getBusyWaitTime();
+
+  virtual void start(double period);
+  virtual bool wait();
+  virtual double getLateness();
+  virtual void resync();
+
+ private:
+  clockid_t clock;
+  int64_t spinTimeNs;
+  int64_t periodNs;
+  int64_t nextCycle;
+};
+
+};
+
+#endif /* ORG_EEROS_CORE_ABSOLUTETIMERSYNC_HPP_ */
@@ -0,0 +1,41 @@
+#ifndef ORG_EEROS_CORE_EVENTFDSYNC_HPP_
+#define ORG_EEROS_CORE_EVENTFDSYNC_HPP_
+
+#include <eeros/core/SyncSource.hpp>
+
+namespace eeros {
+
+/**
+ * Sync source based on a Linux eventfd. Each write of 1 to the file descriptor 
+ * starts one cycle. The descriptor can be handed to other threads, drivers or 
+ * processes, which trigger the executor without knowing about it.
+ * 
+ * @since v1.4
+ */
+class EventFdSync : public SyncSource {
+ public:
+  EventFdSync();
+  virtual ~EventFdSync();
+
+  virtual bool wait();
+  virtual void stop();
+
+  /**
+   * Starts one cycle of the executor.
+   */
+  void trigger();
+
+  /**
+   * Gets the file descriptor of the eventfd.
+   * 
+   * @return file descriptor
+   */
+  int getFd();
+
+ private:
+  int fd;
+};
+
+};
+
+#endif /* ORG_EEROS_CORE_EVENTFDSYNC_HPP_ */
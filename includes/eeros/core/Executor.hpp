@@ -2,10 +2,19 @@
 #define ORG_EEROS_CORE_EXECUTOR_HPP_
 
 #include <vector>
-#include <condition_variable>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <time.h>
+#include <pthread.h>
 
 #include <eeros/core/Runnable.hpp>
 #include <eeros/core/PeriodicCounter.hpp>
+#include <eeros/core/SyncSource.hpp>
+#include <eeros/core/AbsoluteTimerSync.hpp>
+#include <eeros/core/TriggerSync.hpp>
+#include <eeros/core/ParameterSet.hpp>
 #include <eeros/task/Periodic.hpp>
 #include <eeros/logger/Logger.hpp>
 
@@ -28,8 +37,34 @@ namespace control {
   class TimeDomain;
 }
 
+namespace task {
+  class Harmonic;
+  class Async;
+}
+
 namespace safety {
   class SafetySystem;
+  class SafetyEvent;
+};
+
+/**
+ * Defines how the periodic execution of the executor reacts if a cycle 
+ * did not finish before the deadline of the next cycle.
+ */
+enum class OverrunPolicy {
+  catchUp,      // run the missed cycles back to back, optionally bounded
+  skip,         // drop the missed cycles and continue with the next deadline
+  safetyEvent   // trigger a safety event and drop the missed cycles
+};
+
+/**
+ * Defines how the executor reacts on startup if the schedulability analysis, 
+ * see \ref Executor::checkSchedulability, finds a task which may miss its deadline.
+ */
+enum class SchedulabilityCheck {
+  off,      // do not analyse
+  warn,     // log a warning and start anyway
+  refuse    // refuse to start
 };
 
 /**
@@ -123,7 +158,167 @@ class Executor : public Runnable {
   static bool set_priority(int nice);
 
   /**
-   * Starts the executor.
+   * Switches a thread to SCHED_DEADLINE. The kernel guarantees the runtime within 
+   * each period before the relative deadline and throttles the thread beyond it.
+   *
+   * @param runtime - runtime in sec per period
+   * @param deadline - relative deadline in sec
+   * @param period - period in sec
+   * @param thread - kernel thread id, 0 for the calling thread
+   * @return true, if the policy could be set
+   */
+  static bool set_deadline(double runtime, double deadline, double period, pid_t thread = 0);
+
+  /**
+   * Pins the calling thread to a set of CPUs.
+   *
+   * @param cpus - CPU numbers the thread may run on
+   * @return true, if the affinity could be set
+   */
+  static bool set_affinity(const std::vector<int> &cpus);
+
+  /**
+   * Gets the CPUs a thread is allowed to run on.
+   *
+   * @param thread - thread to query, defaults to the calling thread
+   * @return CPU numbers, empty if the affinity could not be read
+   */
+  static std::vector<int> get_affinity(pthread_t thread = pthread_self());
+
+  /**
+   * Pins the thread running the main loop of the executor to a set of CPUs.
+   * Use this to place the main loop on an isolated core.
+   *
+   * @param cpus - CPU numbers the executor may run on
+   */
+  void setAffinity(std::vector<int> cpus);
+
+  /**
+   * Sets the CPUs for all harmonic tasks which do not define an affinity 
+   * of their own, see \ref task::Periodic::setAffinity. Tasks running with 
+   * SCHED_DEADLINE are not pinned.
+   *
+   * @param cpus - CPU numbers the harmonic tasks may run on
+   */
+  void setTaskAffinity(std::vector<int> cpus);
+
+  /**
+   * Sets the source which determines when the next cycle starts, e.g. a timer, 
+   * a fieldbus or a simulator. If no source is set, the executor waits on 
+   * absolute deadlines with an \ref AbsoluteTimerSync.
+   *
+   * @param source - sync source, must live as long as the executor runs
+   */
+  void setSyncSource(SyncSource &source);
+
+  /**
+   * Sets the clock on which the default timer of the periodic execution waits, 
+   * see \ref AbsoluteTimerSync::setClock. The default is CLOCK_MONOTONIC.
+   *
+   * @param clock - clock id, e.g. CLOCK_MONOTONIC or CLOCK_REALTIME
+   */
+  void setClock(clockid_t clock);
+
+  /**
+   * Enables the hybrid wait mode of the default timer of the periodic execution, 
+   * see \ref AbsoluteTimerSync::setBusyWaitTime.
+   *
+   * @param spinTime - time in sec to busy wait before each deadline
+   */
+  void setBusyWaitTime(double spinTime);
+
+  /**
+   * Chooses how the periodic execution handles overruns. A cycle overruns if
+   * it does not finish before the deadline of the next cycle. Missed deadlines, 
+   * maximum lateness and consecutive overruns are counted in \ref counter.
+   * The default is to catch up without a limit.
+   *
+   * @param policy - overrun policy
+   * @param maxCatchUp - maximum number of consecutive overruns caught up, 0 for no limit
+   */
+  void setOverrunPolicy(OverrunPolicy policy, int maxCatchUp = 0);
+
+  /**
+   * Registers the safety event which is triggered upon an overrun
+   * if the policy \ref OverrunPolicy::safetyEvent is chosen.
+   *
+   * @param ss - reference to the safety system 
+   * @param e - safety event 
+   */
+  void registerSafetyEvent(safety::SafetySystem &ss, safety::SafetyEvent &e);
+
+  /**
+   * Spreads the harmonic tasks over the base ticks instead of running all tasks 
+   * with the same period on the same tick. On startup, tasks without a phase of 
+   * their own, see \ref task::Periodic::setPhase, get the phase which keeps the 
+   * worst case tick load lowest, heaviest task first. The load of a task is its 
+   * declared execution time, see \ref task::Periodic::setExecutionTime.
+   *
+   * @param value - true, to assign phases automatically
+   */
+  void setAutoPhase(bool value);
+
+  /**
+   * Reassigns the phases of all harmonic tasks without a phase of their own, 
+   * using the maximum run times measured so far. The new phases are computed on 
+   * the calling thread and handed to the executor, which switches to them at the 
+   * next cycle. The predicted worst case tick load of the new phases and the 
+   * observed one of the current phases are logged. May be called from any thread, 
+   * call it from a non realtime thread to keep the computation out of the cycles.
+   */
+  void balancePhases();
+
+  /**
+   * Chooses whether the executor analyses the schedulability of the task set 
+   * on startup and how it reacts if a deadline may be missed. The default is 
+   * to warn.
+   *
+   * @param check - reaction on startup
+   */
+  void setSchedulabilityCheck(SchedulabilityCheck check);
+
+  /**
+   * Analyses whether all realtime periodics, including nested ones, and the main 
+   * task meet their deadlines with the assigned priorities, see \ref SchedulabilityAnalysis.
+   * The execution time of a periodic is the larger of its declared execution time, 
+   * see \ref task::Periodic::setExecutionTime, and the maximum run time measured by its 
+   * counter. Before the executor runs, only declared times are known. Utilisation and 
+   * response time bound of every periodic are logged. May be called while the 
+   * executor runs to recheck with live data.
+   *
+   * @return true, if all deadlines are met
+   */
+  bool checkSchedulability();
+
+  /**
+   * Adapts the runtime reserved for periodics running with SCHED_DEADLINE, see 
+   * \ref task::Periodic::setDeadlineScheduling, to the maximum run time measured 
+   * so far plus a margin. The runtime never drops below the one set on startup.
+   * Call it while the executor runs, e.g. after a warm up phase. Threads which are 
+   * already stopping are skipped.
+   */
+  void adaptDeadlineBudgets();
+
+  /**
+   * Runs the executor with simulated time instead of waiting for a clock. 
+   * The system time, see \ref System::getTimeNs, advances by exactly one base period 
+   * per cycle and the cycles run back to back as fast as possible. All harmonic 
+   * tasks run synchronously in the executor thread in a fixed order, which makes 
+   * repeated runs deterministic. The system time is simulated from this call on. 
+   * Sequences started from now on, see \ref sequencer::Sequence, run in lockstep 
+   * with the executor: their polling and waiting uses the simulated time and they 
+   * run one after the other between two cycles, see \ref System::runSimulatedThreads. 
+   * Start them before the executor runs or from another sequence.
+   *
+   * @param duration - simulated time in sec after which the executor stops, 0 to run until stopped
+   */
+  void useSimulatedTime(double duration = 0);
+
+  /**
+   * Starts the executor. All timedomains in the task tree are validated and 
+   * sorted first, see \ref control::TimeDomain::validate and \ref control::TimeDomain::sortBlocks. 
+   * Missing connections are logged, the executor starts anyway as some blocks 
+   * have optional inputs.
    */
   virtual void run();
 
@@ -173,20 +368,46 @@ class Executor : public Runnable {
  private:
   Executor();
   void assignPriorities();
+  void assignAffinities();
+  SyncSource& selectSyncSource();
+  void handleOverrun(SyncSource &source);
+  void assignPhases();
+  struct PhaseEntry {
+    task::Periodic *periodic;
+    PeriodicCounter *counter;
+    task::Harmonic *harmonic;
+    bool fixed;
+  };
+  std::vector<PhaseEntry> phases;
+  std::mutex phaseMutex;                     // guards phases and taskThreads against calls from other threads
+  ParameterSet<std::vector<int>> phaseTable; // phases handed to the executor thread
+  std::vector<std::pair<task::Periodic*, task::Async*>> taskThreads;
   double period;
+  AbsoluteTimerSync timer;
+  SyncSource* syncSource;
+  std::unique_ptr<SyncSource> ownSyncSource;
+  std::atomic<SyncSource*> activeSyncSource;
+  std::vector<int> affinity;
+  std::vector<int> taskAffinity;
+  OverrunPolicy overrunPolicy;
+  int maxCatchUp;
+  SchedulabilityCheck schedulabilityCheck;
+  bool autoPhase;
+  safety::SafetySystem* safetySystem;
+  safety::SafetyEvent* safetyEvent;
   task::Periodic* mainTask;
   std::vector<task::Periodic> tasks;
   bool syncWithEtherCatStackSet;
   bool syncWithRosTimeSet;
   bool syncWithRosTopicSet;
+  bool simulatedTimeSet;
+  double simulationDuration;
   bool running = true;
   logger::Logger log;
 #ifdef USE_ROS2
   rclcpp::Executor::SharedPtr subscriberExecutor;
   std::shared_ptr<std::thread> subscriberThread;
-  std::condition_variable cv;
-  std::mutex cv_m;
-  int count;
+  TriggerSync rosTopicSync;
 #endif
 #ifdef USE_ETHERCAT
   ecmasterlib::EcMasterlibMain* etherCATStack;
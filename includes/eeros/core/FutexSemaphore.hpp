@@ -0,0 +1,52 @@
+#ifndef ORG_EEROS_CORE_FUTEXSEMAPHORE_HPP_
+#define ORG_EEROS_CORE_FUTEXSEMAPHORE_HPP_
+
+#include <atomic>
+
+namespace eeros {
+
+/**
+ * A counting semaphore with the same interface as \ref Semaphore, built on an 
+ * atomic counter and the Linux futex system call instead of a mutex and a 
+ * condition variable. Posting never takes a lock and only enters the kernel 
+ * if a thread is actually waiting. A waiting thread sleeps in the kernel, 
+ * no busy waiting is done.
+ * 
+ * @since v1.4
+ */
+class FutexSemaphore {
+ public:
+  /**
+   * Constructs a semaphore with an initial count.
+   * 
+   * @param value - initial count
+   */
+  FutexSemaphore(int value = 0);
+  
+  /**
+   * Blocks until the count is positive and decrements it.
+   */
+  void wait();
+  
+  /**
+   * Blocks until the count is positive and decrements it or until the timeout elapsed.
+   * 
+   * @param timeout_sec - timeout in sec
+   * @return false, if the timeout elapsed
+   */
+  bool wait(double timeout_sec);
+  
+  /**
+   * Increments the count and wakes up one waiting thread.
+   */
+  void post();
+  
+ private:
+  bool tryDecrement();
+  std::atomic<int> counter;
+  std::atomic<int> waiters;
+};
+
+};
+
+#endif /* ORG_EEROS_CORE_FUTEXSEMAPHORE_HPP_ */
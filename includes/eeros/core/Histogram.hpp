@@ -0,0 +1,75 @@
+#ifndef ORG_EEROS_CORE_HISTOGRAM_HPP_
+#define ORG_EEROS_CORE_HISTOGRAM_HPP_
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+
+namespace eeros {
+
+/**
+ * A log-linear histogram of time values in the style of HDR histograms. 
+ * Values are recorded with nanosecond resolution in buckets whose width grows 
+ * with the magnitude of the value, which keeps the relative error below 
+ * 1 / 2^subBucketBits over the whole range from 1 ns to about 2000 s.
+ * The memory is fixed, recording a value neither allocates nor locks.
+ * 
+ * @since v1.4
+ */
+class Histogram {
+ public:
+  static constexpr int subBucketBits = 5;
+  static constexpr int maxValueBits = 41;
+  static constexpr int subBucketCount = 1 << subBucketBits;
+  static constexpr int bucketCount = (maxValueBits - subBucketBits + 1) * subBucketCount;
+
+  Histogram();
+  
+  /**
+   * Records a value. Negative values are recorded as 0, values above the 
+   * range are recorded in the last bucket.
+   * 
+   * @param value - value in sec
+   */
+  void add(double value);
+  
+  /**
+   * Clears all recorded values.
+   */
+  void reset();
+  
+  /**
+   * Returns the value below which the given percentage of all recorded values lie.
+   * The result is the upper limit of the bucket containing this percentile.
+   * 
+   * @param percent - percentage, e.g. 99.9
+   * @return value in sec, 0 if nothing was recorded
+   */
+  double percentile(double percent) const;
+  
+  /**
+   * Returns the number of recorded values.
+   * 
+   * @return count
+   */
+  uint64_t getCount() const;
+  
+  /**
+   * Writes all non-empty buckets, one line per bucket with its lower and upper 
+   * limit in sec and its count, separated by tabs.
+   * 
+   * @param os - output stream, e.g. a file
+   */
+  void dump(std::ostream &os) const;
+  
+ private:
+  static int index(uint64_t ns);
+  static uint64_t lowerLimit(int index);
+  static uint64_t upperLimit(int index);
+  std::array<uint64_t, bucketCount> buckets;
+  uint64_t count;
+};
+
+};
+
+#endif /* ORG_EEROS_CORE_HISTOGRAM_HPP_ */
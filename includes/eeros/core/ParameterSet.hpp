@@ -0,0 +1,114 @@
+#ifndef ORG_EEROS_CORE_PARAMETERSET_HPP_
+#define ORG_EEROS_CORE_PARAMETERSET_HPP_
+
+#include <mutex>
+#include <eeros/core/TripleBuffer.hpp>
+
+namespace eeros {
+
+/**
+ * A parameter set hands parameters from any number of writers, e.g. sequences,
+ * to a single realtime reader, e.g. the run method of a block, without locking
+ * the reader. Writers modify a copy of the parameters and publish it as a whole.
+ * The reader picks up the latest published copy with one atomic load per cycle
+ * and sees a consistent snapshot until it reads again, it never waits for a writer.
+ *
+ * The copies are passed through a \ref TripleBuffer. Writers are serialized by
+ * a mutex which is never taken by the reader. Only one thread may read.
+ *
+ * @tparam P - parameter type, must be copy assignable
+ *
+ * @since v1.4
+ */
+template <typename P>
+class ParameterSet {
+ public:
+  /**
+   * Constructs a parameter set with default constructed parameters.
+   */
+  ParameterSet() : ParameterSet(P{}) { }
+
+  /**
+   * Constructs a parameter set with initial parameters.
+   *
+   * @param init - initial parameters
+   */
+  explicit ParameterSet(const P& init) : buffer(init), latest(init) { }
+
+  ParameterSet(const ParameterSet&) = delete;
+  ParameterSet& operator=(const ParameterSet&) = delete;
+
+  /**
+   * Modifies the parameters and publishes them. The function is applied to the
+   * latest parameters written, so concurrent writers do not lose each other's changes.
+   * Called by writers, never call it from the reader thread.
+   *
+   * @param f - function taking the parameters by reference
+   */
+  template <typename F>
+  void update(F f) {
+    std::lock_guard<std::mutex> lock(mtx);
+    f(latest);
+    buffer.write(latest);
+  }
+
+  /**
+   * Replaces the parameters and publishes them.
+   *
+   * @param p - parameters
+   */
+  void set(const P& p) {
+    update([&p](P& q) { q = p; });
+  }
+
+  /**
+   * Gets a copy of the latest parameters written. They may not have been
+   * read by the reader yet.
+   *
+   * @return parameters
+   */
+  P get() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return latest;
+  }
+
+  /**
+   * Switches the reader to the latest published parameters, if there are any.
+   * Called by the reader only.
+   *
+   * @return true, if new parameters were published since the last call
+   */
+  bool acquire() {
+    return buffer.acquire();
+  }
+
+  /**
+   * Gets the parameters the reader currently uses, without looking for newer ones.
+   * Called by the reader only.
+   *
+   * @return parameters
+   */
+  const P& current() const {
+    return buffer.current();
+  }
+
+  /**
+   * Gets the latest published parameters. The reference stays valid and the
+   * parameters unchanged until the reader calls read or acquire again.
+   * Called by the reader only.
+   *
+   * @return parameters
+   */
+  const P& read() {
+    return buffer.read();
+  }
+
+ private:
+  TripleBuffer<P> buffer;
+  P latest;
+  mutable std::mutex mtx;
+};
+
+};
+
+#endif /* ORG_EEROS_CORE_PARAMETERSET_HPP_ */
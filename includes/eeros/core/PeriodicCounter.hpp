@@ -4,8 +4,10 @@
 #include <chrono>
 #include <vector>
 #include <functional>
+#include <ostream>
 
 #include <eeros/core/Statistics.hpp>
+#include <eeros/core/Histogram.hpp>
 #include <eeros/logger/Logger.hpp>
 
 namespace eeros {
@@ -21,20 +23,41 @@ class PeriodicCounter {
   PeriodicCounter(double period = 0, unsigned logger_category = 0);
   
   void setPeriod(double period);
+  double getPeriod();
   void setResetTime(double sec);
+  void setResourceAccounting(bool enable);
+  bool getResourceAccounting();
   void addDefaultMonitor(double tolerance = 0.05);
 
   void tick();
   void tock();
   void reset();
+  void checkDeadline(double lateness);
 
   void operator >> (logger::LogEntry &event);
   void operator >> (logger::LogEntry &&event);
+  void dumpHistograms(std::ostream &os);
 
   Statistics period;
   Statistics jitter;
   Statistics run;
 
+  Histogram periodHistogram;
+  Histogram jitterHistogram;  // absolute value of the jitter
+  Histogram runHistogram;
+
+  long missedDeadlines;
+  double maxLateness;
+  int consecutiveOverruns;
+  int maxConsecutiveOverruns;
+
+  // only recorded with resource accounting, see setResourceAccounting
+  Statistics cpu;             // CPU time of the calling thread per run
+  long minorFaults;
+  long majorFaults;
+  long voluntarySwitches;
+  long involuntarySwitches;
+
   std::vector<MonitorFunc> monitors;
 
   static void addDefaultMonitor(std::vector<MonitorFunc> &monitors, double period, double tolerance = 0.05);
@@ -46,6 +69,9 @@ class PeriodicCounter {
   int reset_counter;
   time_point start;
   time_point last;
+  bool accounting;
+  double startCpu;
+  long startMinorFaults, startMajorFaults, startVoluntarySwitches, startInvoluntarySwitches;
   logger::Logger log;
 };
 }
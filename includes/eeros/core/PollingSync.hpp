@@ -0,0 +1,34 @@
+#ifndef ORG_EEROS_CORE_POLLINGSYNC_HPP_
+#define ORG_EEROS_CORE_POLLINGSYNC_HPP_
+
+#include <functional>
+#include <eeros/core/SyncSource.hpp>
+
+namespace eeros {
+
+/**
+ * Adapter for sources which can only be polled. The given function is called 
+ * repeatedly until it returns true, sleeping for the poll interval in between.
+ * 
+ * @since v1.4
+ */
+class PollingSync : public SyncSource {
+ public:
+  /**
+   * Constructs a polling sync source.
+   * 
+   * @param ready - returns true, if the next cycle is due
+   * @param pollInterval - time in sec between two polls
+   */
+  PollingSync(std::function<bool()> ready, double pollInterval = 10e-6);
+
+  virtual bool wait();
+
+ private:
+  std::function<bool()> ready;
+  struct timespec interval;
+};
+
+};
+
+#endif /* ORG_EEROS_CORE_POLLINGSYNC_HPP_ */
@@ -0,0 +1,76 @@
+#ifndef ORG_EEROS_CORE_SCHEDULABILITYANALYSIS_HPP_
+#define ORG_EEROS_CORE_SCHEDULABILITYANALYSIS_HPP_
+
+#include <string>
+#include <vector>
+
+namespace eeros {
+
+/**
+ * Checks whether a set of periodic tasks with fixed priorities meets its deadlines.
+ * Each task has an implicit deadline equal to its period. The analysis computes 
+ * the utilisation per priority level and a worst case response time bound per task 
+ * with the classic response time recurrence R = C + sum(ceil(R / Tj) * Cj) over all 
+ * tasks j with higher or equal priority. Tasks pinned to disjoint sets of CPUs do 
+ * not interfere, tasks without an affinity are assumed to share every CPU.
+ * 
+ * @since v1.4
+ */
+class SchedulabilityAnalysis {
+ public:
+  struct Task {
+    std::string name;
+    double period;             // sec, also the deadline
+    double wcet;               // worst case execution time in sec
+    int priority;              // higher value preempts lower value
+    std::vector<int> cpus;     // empty for any CPU
+    double utilisation;        // utilisation of this and all interfering tasks with higher or equal priority
+    double responseTime;       // response time bound in sec, infinity if it diverges
+    bool schedulable;
+  };
+
+  /**
+   * Adds a task to the analysis.
+   * 
+   * @param name - name used in the report
+   * @param period - period and deadline in sec
+   * @param wcet - worst case execution time in sec
+   * @param priority - priority, a higher value preempts a lower value
+   * @param cpus - CPUs the task may run on, empty for any CPU
+   */
+  void add(std::string name, double period, double wcet, int priority, std::vector<int> cpus = {});
+  
+  /**
+   * Removes all tasks.
+   */
+  void clear();
+  
+  /**
+   * Computes utilisation and response time bound of all tasks.
+   * 
+   * @return true, if all tasks meet their deadlines
+   */
+  bool analyse();
+  
+  /**
+   * Gets the total utilisation of all tasks, which may exceed 1 on several CPUs.
+   * 
+   * @return utilisation
+   */
+  double getUtilisation() const;
+  
+  /**
+   * Gets the tasks ordered by descending priority with the results of the last analysis.
+   * 
+   * @return tasks
+   */
+  const std::vector<Task>& getTasks() const;
+  
+ private:
+  static bool interferes(const Task &a, const Task &b);
+  std::vector<Task> tasks;
+};
+
+}
+
+#endif // ORG_EEROS_CORE_SCHEDULABILITYANALYSIS_HPP_
@@ -0,0 +1,37 @@
+#ifndef ORG_EEROS_CORE_SIMULATEDTIMESYNC_HPP_
+#define ORG_EEROS_CORE_SIMULATEDTIMESYNC_HPP_
+
+#include <eeros/core/SyncSource.hpp>
+
+namespace eeros {
+
+/**
+ * Sync source which never waits. Before each cycle it advances the simulated 
+ * system time, see \ref System::useSimulatedTime, by exactly one period and 
+ * runs the threads taking part in the simulation which wait for this time, 
+ * see \ref System::runSimulatedThreads.
+ * 
+ * @since v1.4
+ */
+class SimulatedTimeSync : public SyncSource {
+ public:
+  /**
+   * Constructs a simulated time sync source.
+   * 
+   * @param duration - simulated time in sec after which the source stops, 0 to run until stopped
+   */
+  SimulatedTimeSync(double duration = 0);
+
+  virtual void start(double period);
+  virtual bool wait();
+
+ private:
+  double duration;
+  uint64_t periodNs;
+  uint64_t cycles;
+  uint64_t count;
+};
+
+};
+
+#endif /* ORG_EEROS_CORE_SIMULATEDTIMESYNC_HPP_ */
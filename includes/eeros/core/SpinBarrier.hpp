@@ -0,0 +1,50 @@
+#ifndef ORG_EEROS_CORE_SPINBARRIER_HPP_
+#define ORG_EEROS_CORE_SPINBARRIER_HPP_
+
+#include <atomic>
+
+namespace eeros {
+
+/**
+ * A barrier for a fixed number of threads which busy waits instead of sleeping.
+ * Once all threads arrived, all of them continue and the barrier can be used 
+ * again. Waiting costs no system call and the threads continue within a few 
+ * hundred nanoseconds, but a waiting thread occupies its CPU. Use it only for 
+ * short waits between threads running on different CPUs. After spinning for 
+ * about 20 microseconds, a waiting thread yields its CPU on every further check. 
+ * Yielding only lets threads of the same priority run: a realtime thread waiting 
+ * for a thread with a lower priority on the same CPU blocks it, so every thread 
+ * using the barrier needs a CPU of its own.
+ * 
+ * @since v1.4
+ */
+class SpinBarrier {
+ public:
+  /**
+   * Constructs a barrier.
+   * 
+   * @param count - number of threads which have to arrive
+   */
+  SpinBarrier(unsigned count);
+
+  /**
+   * Blocks until all threads arrived.
+   */
+  void wait();
+
+  /**
+   * Gets the number of threads which have to arrive.
+   * 
+   * @return number of threads
+   */
+  unsigned getCount() const;
+
+ private:
+  const unsigned count;
+  std::atomic<unsigned> waiting;
+  std::atomic<unsigned> generation;
+};
+
+};
+
+#endif /* ORG_EEROS_CORE_SPINBARRIER_HPP_ */
@@ -0,0 +1,98 @@
+#ifndef ORG_EEROS_CORE_SPSCRINGBUFFER_HPP_
+#define ORG_EEROS_CORE_SPSCRINGBUFFER_HPP_
+
+#include <atomic>
+#include <vector>
+#include <cstddef>
+
+namespace eeros {
+
+/**
+ * A ring buffer for a single producer thread and a single consumer thread which
+ * never locks and never allocates after construction. Pushing to a full buffer
+ * fails instead of waiting, so the producer never blocks on the consumer.
+ * Use it to pass batches of values from a fast to a slow thread.
+ *
+ * Unlike \ref RingBuffer, the capacity is chosen at runtime. It is rounded up
+ * to a power of two.
+ *
+ * @tparam T - value type, must be default constructible and copy assignable
+ *
+ * @since v1.4
+ */
+template <typename T>
+class SpscRingBuffer {
+ public:
+  /**
+   * Constructs a ring buffer and allocates its items.
+   *
+   * @param capacity - minimum number of items the buffer can hold
+   */
+  explicit SpscRingBuffer(std::size_t capacity) : items(roundUp(capacity)), mask(items.size() - 1), head(0), tail(0) { }
+
+  SpscRingBuffer(const SpscRingBuffer&) = delete;
+  SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+  /**
+   * Appends an item. Called by the producer only.
+   *
+   * @param v - item
+   * @return false, if the buffer is full and the item was dropped
+   */
+  bool push(const T& v) {
+    std::size_t h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) == items.size()) return false;
+    items[h & mask] = v;
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * Removes the oldest item. Called by the consumer only.
+   *
+   * @param v - receives the item
+   * @return false, if the buffer is empty
+   */
+  bool pop(T& v) {
+    std::size_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire)) return false;
+    v = items[t & mask];
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * Gets the number of items in the buffer. The result is exact only
+   * if called by the producer or the consumer while the other one is idle.
+   *
+   * @return number of items
+   */
+  std::size_t length() const {
+    return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+  }
+
+  /**
+   * Gets the number of items the buffer can hold.
+   *
+   * @return capacity
+   */
+  std::size_t size() const {
+    return items.size();
+  }
+
+ private:
+  static std::size_t roundUp(std::size_t n) {
+    std::size_t size = 1;
+    while (size < n) size <<= 1;
+    return size;
+  }
+
+  std::vector<T> items;
+  const std::size_t mask;
+  alignas(64) std::atomic<std::size_t> head;  // next item to write, owned by the producer
+  alignas(64) std::atomic<std::size_t> tail;  // next item to read, owned by the consumer
+};
+
+};
+
+#endif /* ORG_EEROS_CORE_SPSCRINGBUFFER_HPP_ */
@@ -0,0 +1,64 @@
+#ifndef ORG_EEROS_CORE_SYNCSOURCE_HPP_
+#define ORG_EEROS_CORE_SYNCSOURCE_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <time.h>
+
+namespace eeros {
+
+/**
+ * A sync source determines when the \ref Executor starts its next cycle.
+ * The executor calls \ref wait before each cycle, which blocks until the cycle is due.
+ * Any device, bus or simulator can drive the executor by implementing this interface.
+ * 
+ * @since v1.4
+ */
+class SyncSource {
+ public:
+  virtual ~SyncSource();
+
+  /**
+   * Called once by the executor before the first cycle.
+   * 
+   * @param period - base period of the executor in sec
+   */
+  virtual void start(double period);
+
+  /**
+   * Blocks until the next cycle is due.
+   * 
+   * @return false, if the source was stopped and no further cycle must run
+   */
+  virtual bool wait() = 0;
+
+  /**
+   * Makes a blocking \ref wait return. Called when the executor stops.
+   */
+  virtual void stop();
+
+  /**
+   * Called by the executor at the end of each cycle. Sources with deadlines 
+   * return by how much the deadline of the next cycle is already missed.
+   * 
+   * @return lateness in sec, 0 or negative if the next deadline is not missed
+   */
+  virtual double getLateness();
+
+  /**
+   * Drops all missed cycles, so that the next deadline lies in the future.
+   */
+  virtual void resync();
+
+ protected:
+  static constexpr int64_t NS_PER_SEC = 1000000000;
+  static int64_t now(clockid_t clock);
+  static struct timespec toTimespec(int64_t ns);
+
+  double period = 0;
+  std::atomic<bool> stopped{false};
+};
+
+};
+
+#endif /* ORG_EEROS_CORE_SYNCSOURCE_HPP_ */
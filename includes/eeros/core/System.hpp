@@ -43,8 +43,88 @@ class System {
   static void useRosTime();
 #endif
 
+  /**
+   * Makes the system return a simulated time instead of reading a clock.
+   * The simulated time only changes with \ref advanceSimulatedTime.
+   *
+   * @param startNs - initial simulated time in nsec
+   */
+  static void useSimulatedTime(uint64_t startNs = 0);
+
+  /**
+   * Advances the simulated time.
+   *
+   * @param ns - time step in nsec
+   */
+  static void advanceSimulatedTime(uint64_t ns);
+
+  /**
+   * Makes the system read its clock again after a simulation. Threads waiting 
+   * for the simulated time, see \ref sleepUntilNs, continue immediately.
+   */
+  static void useRealTime();
+
+  /**
+   * Returns true if the system time is simulated.
+   *
+   * @return true, if simulated
+   */
+  static bool isSimulatedTime();
+
+  /**
+   * Waits until the system time reached the given time. A thread taking part in 
+   * the simulation, see \ref addSimulatedThread, waits until \ref runSimulatedThreads 
+   * resumes it. Other threads sleep.
+   *
+   * @param timeNs - system time in nsec to wait for
+   */
+  static void sleepUntilNs(uint64_t timeNs);
+
+  /**
+   * Makes a new thread take part in the simulation. Threads taking part never run 
+   * concurrently, they run one after the other in the order of the times they wait 
+   * for, see \ref sleepUntilNs, and for the same time in the order they started 
+   * waiting. Therefore they run in the same order in every run. Call it before the 
+   * thread is started, from the thread running the simulation or from a thread 
+   * taking part, and pass the ticket to \ref enterSimulatedThread in the new thread. 
+   * The new thread first runs when the threads waiting for the current time ran.
+   *
+   * @return ticket of the new thread
+   */
+  static uint64_t addSimulatedThread();
+
+  /**
+   * Waits until the calling thread, added with \ref addSimulatedThread, is resumed 
+   * for the first time.
+   *
+   * @param ticket - ticket returned by \ref addSimulatedThread
+   */
+  static void enterSimulatedThread(uint64_t ticket);
+
+  /**
+   * Ends taking part in the simulation, call it before the thread ends. A thread 
+   * taking part must neither end nor block in another way without calling it, 
+   * as the simulation waits for it.
+   */
+  static void leaveSimulatedThread();
+
+  /**
+   * Returns true if the calling thread takes part in the simulation.
+   *
+   * @return true, if taking part
+   */
+  static bool isSimulatedThread();
+
+  /**
+   * Resumes all threads taking part in the simulation which wait for the current 
+   * simulated time or an earlier one, one after the other, and returns when all of 
+   * them wait again or left. \ref SimulatedTimeSync calls it after advancing the time.
+   */
+  static void runSimulatedThreads();
+
  private:
   System();
+  static void releaseSimulatedThreads();
 };
 
 }
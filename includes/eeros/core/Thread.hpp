@@ -7,6 +7,7 @@
 #include <thread>
 #include <functional>
 #include <string>
+#include <vector>
 
 namespace eeros {
 
@@ -26,10 +27,12 @@ class Thread {
    * default priority.
    * If the default priority of 20 chosen, no priority assigment is made and the
    * thread will start to run with default priority. 
+   * If CPUs are chosen, the thread is pinned to them before it starts to run.
    * 
    * @param priority - priority of the thread
+   * @param affinity - CPU numbers the thread may run on, empty for any CPU
    */
-  Thread(int priority = 20);
+  Thread(int priority = 20, std::vector<int> affinity = {});
   
   /**
    * Destructor
@@ -43,6 +46,13 @@ class Thread {
    */
   virtual std::string getId() const;
   
+  /** 
+   * Returns the CPUs the thread is allowed to run on.
+   * 
+   * @return - CPU numbers
+   */
+  virtual std::vector<int> getAffinity();
+  
   /** 
    * Waits for the thread to finish
    */
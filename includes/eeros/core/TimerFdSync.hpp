@@ -0,0 +1,47 @@
+#ifndef ORG_EEROS_CORE_TIMERFDSYNC_HPP_
+#define ORG_EEROS_CORE_TIMERFDSYNC_HPP_
+
+#include <eeros/core/SyncSource.hpp>
+
+namespace eeros {
+
+/**
+ * Sync source based on a periodic Linux timerfd. The kernel rearms the timer
+ * itself and counts expirations which were missed while a cycle overran.
+ * Missed cycles are caught up unless the executor resyncs.
+ * 
+ * @since v1.4
+ */
+class TimerFdSync : public SyncSource {
+ public:
+  /**
+   * Constructs a timerfd sync source.
+   * 
+   * @param clock - clock id, CLOCK_MONOTONIC or CLOCK_REALTIME
+   */
+  TimerFdSync(clockid_t clock = CLOCK_MONOTONIC);
+  virtual ~TimerFdSync();
+
+  virtual void start(double period);
+  virtual bool wait();
+  virtual double getLateness();
+  virtual void resync();
+
+  /**
+   * Gets the file descriptor of the timer, e.g. to add it to an epoll set.
+   * 
+   * @return file descriptor
+   */
+  int getFd();
+
+ private:
+  clockid_t clock;
+  int fd;
+  int64_t periodNs;
+  int64_t nextCycle;
+  uint64_t pending;
+};
+
+};
+
+#endif /* ORG_EEROS_CORE_TIMERFDSYNC_HPP_ */
@@ -0,0 +1,145 @@
+#ifndef ORG_EEROS_CORE_TRACER_HPP_
+#define ORG_EEROS_CORE_TRACER_HPP_
+
+#include <atomic>
+#include <array>
+#include <memory>
+#include <vector>
+#include <set>
+#include <string>
+#include <mutex>
+#include <thread>
+#include <cstdio>
+#include <cstdint>
+
+namespace eeros {
+
+/**
+ * The tracer records a timeline of events per thread, e.g. the start and end of 
+ * each cycle, time domain or safety system run. It is always compiled in and can be 
+ * switched on and off at runtime. While switched off, recording an event costs a 
+ * single relaxed atomic load.
+ * 
+ * Each thread writes into its own lock-free ring buffer of compact binary events.
+ * Buffers are only allocated while the tracer is switched on. When a thread exits,
+ * its buffer is recycled for the next thread, unused buffers are freed by \ref stop.
+ * A non realtime thread drains the buffers and writes them to a file in the 
+ * Chrome Trace Event JSON format, which can be opened with chrome://tracing or 
+ * the Perfetto UI. If a buffer is full, events are dropped and counted.
+ * 
+ * Event names are not copied, they must live as long as the tracer runs. 
+ * Use \ref intern for names which are built at runtime.
+ * 
+ * @since v1.4
+ */
+class Tracer {
+ public:
+  static constexpr int bufferSize = 16384;   // events per thread, power of two
+
+  /**
+   * Get the tracer instance as a singleton
+   */
+  static Tracer& instance();
+
+  Tracer(Tracer const&) = delete;
+  void operator=(Tracer const&) = delete;
+  ~Tracer();
+
+  /**
+   * Opens the trace file, starts the writer thread and enables recording.
+   * 
+   * @param fileName - name of the trace file
+   * @param flushPeriod - period in sec with which the buffers are drained
+   */
+  void start(const std::string &fileName, double flushPeriod = 0.01);
+
+  /**
+   * Disables recording, writes the remaining events, closes the trace file and 
+   * frees the buffers of exited threads.
+   */
+  void stop();
+
+  /**
+   * Allocates the ring buffer of the calling thread if the tracer is switched on. 
+   * Call this during the setup of a realtime thread, otherwise the buffer is 
+   * allocated upon the first event.
+   */
+  static void registerThread();
+
+  /**
+   * Returns a copy of a name which stays valid as long as the process runs. 
+   * Do not call this in a realtime loop.
+   * 
+   * @param name - name
+   * @return pointer to the stored name
+   */
+  static const char* intern(const std::string &name);
+
+  /**
+   * Returns the number of events dropped because of full buffers.
+   * 
+   * @return dropped events
+   */
+  uint64_t getDropped();
+
+  static bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+  static void begin(const char *name) { if (isEnabled()) record(name, 'B'); }
+  static void end(const char *name) { if (isEnabled()) record(name, 'E'); }
+  static void instant(const char *name) { if (isEnabled()) record(name, 'i'); }
+
+  /**
+   * Records a begin event when constructed and the matching end event when 
+   * destroyed, so the span is closed on every exit path, also if an exception is thrown.
+   */
+  class Span {
+   public:
+    explicit Span(const char *name) : name(name) { begin(name); }
+    ~Span() { end(name); }
+    Span(const Span&) = delete;
+    Span& operator=(const Span&) = delete;
+   private:
+    const char *name;
+  };
+
+ private:
+  struct Event {
+    uint64_t time;
+    const char *name;
+    char phase;
+  };
+  struct ThreadBuffer {
+    std::array<Event, bufferSize> events;
+    std::atomic<uint32_t> head{0};   // written by the owning thread
+    std::atomic<uint32_t> tail{0};   // written by the writer thread
+    std::atomic<uint64_t> dropped{0};
+    long tid;
+  };
+  struct ThreadHandle {
+    ThreadBuffer *buffer = nullptr;
+    ~ThreadHandle();   // hands the buffer back when the thread exits
+  };
+
+  Tracer();
+  static void record(const char *name, char phase);
+  static ThreadBuffer* getBuffer();
+  void flush();
+  void flush(ThreadBuffer &b);
+  uint64_t countDropped();
+  void writeLoop(double flushPeriod);
+
+  static std::atomic<bool> enabled;
+  static thread_local ThreadHandle handle;
+  std::mutex mtx;
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+  std::vector<ThreadBuffer*> unused;   // buffers of exited threads
+  std::set<std::string> names;
+  std::FILE *file;
+  bool firstEvent;
+  std::atomic<bool> writing;
+  std::thread writer;
+  int pid;
+};
+
+};
+
+#endif /* ORG_EEROS_CORE_TRACER_HPP_ */
@@ -0,0 +1,31 @@
+#ifndef ORG_EEROS_CORE_TRIGGERSYNC_HPP_
+#define ORG_EEROS_CORE_TRIGGERSYNC_HPP_
+
+#include <eeros/core/SyncSource.hpp>
+#include <eeros/core/FutexSemaphore.hpp>
+
+namespace eeros {
+
+/**
+ * Sync source for external triggers within the process, e.g. a callback of 
+ * a fieldbus stack or a subscriber. Each call to \ref trigger starts one cycle.
+ * 
+ * @since v1.4
+ */
+class TriggerSync : public SyncSource {
+ public:
+  virtual bool wait();
+  virtual void stop();
+
+  /**
+   * Starts one cycle of the executor. Can be called from any thread.
+   */
+  void trigger();
+
+ private:
+  FutexSemaphore semaphore;
+};
+
+};
+
+#endif /* ORG_EEROS_CORE_TRIGGERSYNC_HPP_ */
@@ -0,0 +1,115 @@
+#ifndef ORG_EEROS_CORE_TRIPLEBUFFER_HPP_
+#define ORG_EEROS_CORE_TRIPLEBUFFER_HPP_
+
+#include <atomic>
+#include <stdint.h>
+
+namespace eeros {
+
+/**
+ * A triple buffer hands the latest value from one writer thread to one reader
+ * thread without locking. Neither thread ever waits for the other: the writer
+ * can publish at any rate and the reader always gets the latest published value.
+ * Values published in between are skipped.
+ *
+ * The values are held in three slots: one is read, one is written and one holds
+ * the latest published value. Publishing and acquiring swap a slot with a single
+ * atomic exchange. Only one thread may write and only one thread may read.
+ *
+ * @tparam T - value type, must be copy assignable
+ *
+ * @since v1.4
+ */
+template <typename T>
+class TripleBuffer {
+ public:
+  /**
+   * Constructs a triple buffer with default constructed values.
+   */
+  TripleBuffer() : TripleBuffer(T{}) { }
+
+  /**
+   * Constructs a triple buffer with an initial value. The reader sees it
+   * until the writer publishes.
+   *
+   * @param init - initial value
+   */
+  explicit TripleBuffer(const T& init) : state(1), front(0), back(2) {
+    for (auto& s : slots) s = init;
+  }
+
+  TripleBuffer(const TripleBuffer&) = delete;
+  TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+  /**
+   * Gets the slot the writer fills before publishing it with \ref publish.
+   * Called by the writer only.
+   *
+   * @return value to be written
+   */
+  T& writeBuffer() {
+    return slots[back];
+  }
+
+  /**
+   * Publishes the slot returned by \ref writeBuffer. Called by the writer only.
+   */
+  void publish() {
+    back = state.exchange(back | fresh, std::memory_order_acq_rel) & index;
+  }
+
+  /**
+   * Publishes a value. Called by the writer only.
+   *
+   * @param value - value
+   */
+  void write(const T& value) {
+    slots[back] = value;
+    publish();
+  }
+
+  /**
+   * Switches the reader to the latest published value, if there is one.
+   * Called by the reader only.
+   *
+   * @return true, if a new value was published since the last call
+   */
+  bool acquire() {
+    if (!(state.load(std::memory_order_relaxed) & fresh)) return false;
+    front = state.exchange(front, std::memory_order_acq_rel) & index;
+    return true;
+  }
+
+  /**
+   * Gets the value the reader currently holds, without looking for a newer one.
+   * Called by the reader only.
+   *
+   * @return value
+   */
+  const T& current() const {
+    return slots[front];
+  }
+
+  /**
+   * Gets the latest published value. The reference stays valid and the value
+   * unchanged until the reader calls read or acquire again. Called by the reader only.
+   *
+   * @return value
+   */
+  const T& read() {
+    acquire();
+    return slots[front];
+  }
+
+ private:
+  static constexpr uint8_t index = 0x3;
+  static constexpr uint8_t fresh = 0x4;
+  T slots[3];
+  std::atomic<uint8_t> state;  // index of the published slot and fresh flag
+  uint8_t front;               // slot of the reader
+  uint8_t back;                // slot of the writer
+};
+
+};
+
+#endif /* ORG_EEROS_CORE_TRIPLEBUFFER_HPP_ */
@@ -102,7 +102,8 @@ class BaseSequence {
   /**
    * The function \ref checkExitCondition() periodically checks for the exit 
    * condition to become true. In between checks the thread will wait for 
-   * polling time in ms.
+   * polling time in ms. With simulated time, see \ref Executor::useSimulatedTime, 
+   * the polling time is simulated time as well.
    * 
    * @param timeInMilliseconds - polling time in ms
    */
@@ -158,6 +159,7 @@ class BaseSequence {
   virtual int action(); // has to be implemented in custom step or sequence
   virtual int operator() () = 0; // has to be implemented in derived class	
   void resetAbort();
+  void sleepPollingTime();  // waits on the system time, which may be simulated
 
   std::string name;
   Sequencer& seq; // reference to sequencer
@@ -2,7 +2,7 @@
 #define ORG_EEROS_SEQUENCER_CONDITIONTIMEOUT_HPP_
 
 #include <eeros/sequencer/Condition.hpp>
-#include <chrono>
+#include <eeros/core/System.hpp>
 
 namespace eeros {
 	namespace sequencer {
@@ -17,19 +17,18 @@ namespace eeros {
 					resetTimeout();
 					return false;
 				}
-				auto now = std::chrono::steady_clock::now();
-				auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(now - startTime);
-				return (duration.count() > timeout * 1000);
+				uint64_t duration = System::getTimeNs() - startTime;	// system time, may be simulated
+				return (duration / 1e9 > timeout);
 			};
 			
 			void setTimeoutTime(double timeInSec) {timeout = timeInSec;}	// 0 = not set or infinite
 			void resetTimeout() {
 				started = true;
-				startTime = std::chrono::steady_clock::now();
+				startTime = System::getTimeNs();
 			}
 		private:
 			bool started = false;			
-			std::chrono::steady_clock::time_point startTime;
+			uint64_t startTime = 0;
 			double timeout;	// 0 = not set or infinite, in seconds
 		};
 		
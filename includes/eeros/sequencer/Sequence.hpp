@@ -2,6 +2,7 @@
 #define ORG_EEROS_SEQUENCER_SEQUENCE_HPP_
 
 #include <eeros/sequencer/BaseSequence.hpp>
+#include <atomic>
 #include <condition_variable>
 #include <future>
 
@@ -69,7 +70,9 @@ class Sequence : public BaseSequence {
   virtual int action() = 0;
   
   /**
-   * Waits for this sequence to finish its current run. This call will block.
+   * Waits for this sequence to finish its current run. This call will block. 
+   * A sequence taking part in a simulation, see \ref System::addSimulatedThread, 
+   * checks with its polling time whether the sequence finished instead.
    */
   void wait();
 
@@ -86,8 +89,9 @@ class Sequence : public BaseSequence {
  
  private:
   Sequence(std::string name, Sequencer& seq, BaseSequence* caller, bool blocking);
-  int run();
+  int run(uint64_t ticket);
   std::future<int> fut;
+  std::atomic<bool> finished{false};
   int retVal;
 };
 
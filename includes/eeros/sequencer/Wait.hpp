@@ -2,12 +2,14 @@
 #define ORG_EEROS_SEQUENCER_WAIT_HPP_
 
 #include <eeros/sequencer/Step.hpp>
+#include <eeros/core/System.hpp>
 
 namespace eeros {
 namespace sequencer {
 
 /**
  * This is a special \ref Step which simply wait for a given time.
+ * The time is the system time, which may be simulated, see \ref System::getTimeNs.
  * 
  * @since v1.0
  */
@@ -35,10 +37,10 @@ public:
   int operator() (double waitingTime) {this->waitingTime = waitingTime; return start();}
  
  private:
-  int action() {time = std::chrono::steady_clock::now(); return 0;}
-  bool checkExitCondition() {return ((std::chrono::duration<double>)(std::chrono::steady_clock::now() - time)).count() > waitingTime;}
+  int action() {time = System::getTimeNs(); return 0;}
+  bool checkExitCondition() {return (System::getTimeNs() - time) / 1e9 > waitingTime;}
   
-  std::chrono::time_point<std::chrono::steady_clock> time;
+  uint64_t time;
   double waitingTime;
 };
 
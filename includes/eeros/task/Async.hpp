@@ -2,9 +2,12 @@
 #define ORG_EEROS_TASK_ASYNC_HPP_
 
 #include <thread>
+#include <vector>
+#include <atomic>
+#include <sys/types.h>
 
 #include <eeros/core/Runnable.hpp>
-#include <eeros/core/Semaphore.hpp>
+#include <eeros/core/FutexSemaphore.hpp>
 #include <eeros/core/PeriodicCounter.hpp>
 #include <eeros/logger/Logger.hpp>
 
@@ -13,12 +16,31 @@ namespace task {
 
 class Async : public Runnable {
  public:
-  Async(Runnable &task, bool realtime = false, int nice = 0);
-  Async(Runnable *task, bool realtime = false, int nice = 0);
+  /**
+   * Creates the thread of an asynchronous task. A realtime thread runs with SCHED_FIFO 
+   * and the priority derived from nice, or with SCHED_DEADLINE if a runtime is given.
+   * 
+   * @param task - runnable
+   * @param realtime - true, for a realtime thread
+   * @param nice - nice level, see \ref Executor::set_priority
+   * @param affinity - CPUs the thread may run on, empty for any CPU
+   * @param runtime - SCHED_DEADLINE runtime in sec per period, 0 for SCHED_FIFO
+   * @param period - SCHED_DEADLINE period and relative deadline in sec
+   */
+  Async(Runnable &task, bool realtime = false, int nice = 0, std::vector<int> affinity = {}, double runtime = 0, double period = 0);
+  Async(Runnable *task, bool realtime = false, int nice = 0, std::vector<int> affinity = {}, double runtime = 0, double period = 0);
   virtual ~Async();
   virtual void run();
   void stop();
   void join();
+  std::vector<int> getAffinity();
+  void setSynchronous(bool synchronous);
+  void setInline(bool runInline);
+  void waitFinished();
+  bool waitReady(double timeout_sec);
+  double getSetupTime();
+  pid_t getThreadId();
+  bool getScheduled();
 
   PeriodicCounter counter;
 
@@ -27,10 +49,20 @@ class Async : public Runnable {
   Runnable &task;
   bool realtime;
   int nice;
-  Semaphore semaphore;
-  std::thread thread;
+  std::vector<int> affinity;
+  double runtime;
+  double period;
+  std::atomic<pid_t> tid;
+  FutexSemaphore semaphore;
+  bool synchronous;
+  bool runInline;
+  FutexSemaphore finishedRun;
+  FutexSemaphore ready;
+  double setupTime;
+  std::atomic<bool> scheduled;
   bool finished;
   logger::Logger log;
+  std::thread thread;   // must be the last member, the thread starts upon construction
 };
 
 }
@@ -0,0 +1,56 @@
+#ifndef ORG_EEROS_TASK_FORKJOIN_HPP_
+#define ORG_EEROS_TASK_FORKJOIN_HPP_
+
+#include <vector>
+#include <eeros/core/Runnable.hpp>
+#include <eeros/task/Async.hpp>
+#include <eeros/task/Harmonic.hpp>
+
+namespace eeros {
+namespace task {
+
+/**
+ * Runs a group of independent asynchronous tasks in parallel and waits until 
+ * all of them finished. Each task runs on its own, already created thread.
+ * As with \ref Harmonic, a task with divisor n only runs every n-th time, 
+ * shifted by its phase.
+ * 
+ * @since v1.4
+ */
+class ForkJoin : public Runnable {
+ public:
+  /**
+   * Adds a task to the group. The task is switched to synchronous mode.
+   * 
+   * @param task - asynchronous task
+   * @param n - divisor
+   * @param phase - phase, see \ref Harmonic
+   */
+  void add(Async &task, int n = 1, int phase = 0);
+  
+  /**
+   * Gets the harmonic which decides when a task of the group runs.
+   * 
+   * @param task - asynchronous task
+   * @return harmonic, nullptr if the task is not part of the group
+   */
+  Harmonic *find(Runnable &task);
+  
+  /**
+   * Triggers all due tasks and returns after the last one finished.
+   */
+  virtual void run();
+  
+ private:
+  struct Entry {
+    Async *task;
+    Harmonic harmonic;
+    bool triggered;
+  };
+  std::vector<Entry> tasks;
+};
+
+}
+}
+
+#endif // ORG_EEROS_TASK_FORKJOIN_HPP_
@@ -6,14 +6,25 @@
 namespace eeros {
 	namespace task {
 
+		/**
+		 * Runs a task every n-th time it is run itself. With phase p the task
+		 * runs at the calls p, p + n, p + 2n, ... (counting from 1); phase 0
+		 * runs it at the calls n, 2n, ... The divisor must be at least 1 and
+		 * the phase in [0, n), otherwise std::invalid_argument is thrown.
+		 */
 		class Harmonic : public Runnable {
 		public:
-			Harmonic(Runnable &task, int n = 1);
-			Harmonic(Runnable *task, int n = 1);
+			Harmonic(Runnable &task, int n = 1, int phase = 0);
+			Harmonic(Runnable *task, int n = 1, int phase = 0);
 			Runnable *getTask();
+			int getDivisor();
+			int getPhase();
+			void setPhase(int phase);
+			bool tick();
 			virtual void run();
 		private:
-			int n, k;
+			int n, phase;
+			long ticks;
 			Runnable *task;
 		};
 
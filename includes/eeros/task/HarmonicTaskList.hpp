@@ -11,8 +11,9 @@ namespace eeros {
 		class HarmonicTaskList : public Runnable {
 		public:
 			virtual void run();
-			virtual void add(Runnable *t, int n = 1);
-			virtual void add(Runnable &t, int n = 1);
+			virtual void add(Runnable *t, int n = 1, int phase = 0);
+			virtual void add(Runnable &t, int n = 1, int phase = 0);
+			Harmonic *find(Runnable &t);
 			std::vector<Harmonic> tasks;
 		};
 
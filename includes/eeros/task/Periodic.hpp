@@ -29,7 +29,7 @@ class Periodic {
    * @param nice - nice level of the associated thread
    */
   Periodic(const std::string name, double period, Runnable &task, bool realtime = true, int nice = -1)
-      : name(name), period(period), task(&task), realtime(realtime), nice(nice) { }
+      : name(name), period(period), task(&task), realtime(realtime), nice(nice), independent(false), phase(-1), executionTime(0), deadlineScheduling(false), deadlineRuntime(0), resourceAccounting(false) { }
       
   /**
    * Constructs a periodic instance. Upon installation in the @ref Executor the runnable object will
@@ -42,7 +42,7 @@ class Periodic {
    * @param nice - nice level of the associated thread
    */
   Periodic(const std::string name, double period, Runnable *task, bool realtime = true, int nice = -1)
-      : name(name), period(period), task(task), realtime(realtime), nice(nice) { }
+      : name(name), period(period), task(task), realtime(realtime), nice(nice), independent(false), phase(-1), executionTime(0), deadlineScheduling(false), deadlineRuntime(0), resourceAccounting(false) { }
       
   /**
    * You can a default monitor to a periodic. Such a monitor will will log a message (on level WARN)
@@ -109,6 +109,143 @@ class Periodic {
     nice = value;
   }
 
+  /**
+   * Pins the thread of the periodic to a set of CPUs. If no CPUs are chosen, 
+   * the executor places the thread according to its own task affinity.
+   * 
+   * @param cpus - CPU numbers the thread may run on
+   */
+  void setAffinity(std::vector<int> cpus) {
+    affinity = cpus;
+  }
+
+  /**
+   * Gets the CPUs the thread of the periodic is pinned to.
+   * 
+   * @return CPU numbers, empty if not pinned
+   */
+  std::vector<int> getAffinity() {
+    return affinity;
+  }
+
+  /**
+   * Declares the periodic as independent of its siblings. All independent periodics 
+   * of the same list run in parallel on their own threads and the executor waits for 
+   * all of them before it continues, e.g. with the main task. Pin them to different 
+   * CPUs with \ref setAffinity to actually use several cores.
+   * 
+   * @param value - true, if the periodic is independent
+   */
+  void setIndependent(bool value) {
+    independent = value;
+  }
+
+  /**
+   * Gets the independent flag of the periodic.
+   * 
+   * @return independent
+   */
+  bool getIndependent() {
+    return independent;
+  }
+
+  /**
+   * Sets the phase of the periodic. A periodic with k times the base period 
+   * runs on the base ticks p, p + k, p + 2k, ... with phase p. Periodics without 
+   * a phase are spread automatically if \ref Executor::setAutoPhase is enabled, 
+   * otherwise they all run with phase 0.
+   * 
+   * @param value - phase in base ticks, -1 for automatic
+   */
+  void setPhase(int value) {
+    phase = value;
+  }
+
+  /**
+   * Gets the phase of the periodic.
+   * 
+   * @return phase in base ticks, -1 for automatic
+   */
+  int getPhase() {
+    return phase;
+  }
+
+  /**
+   * Declares the expected worst case execution time of the runnable. The executor 
+   * uses it to assign phases before any run time was measured.
+   * 
+   * @param value - execution time in sec, 0 if unknown
+   */
+  void setExecutionTime(double value) {
+    executionTime = value;
+  }
+
+  /**
+   * Gets the declared execution time of the periodic.
+   * 
+   * @return execution time in sec, 0 if unknown
+   */
+  double getExecutionTime() {
+    return executionTime;
+  }
+
+  /**
+   * Runs the thread of the periodic with SCHED_DEADLINE instead of SCHED_FIFO. The kernel 
+   * reserves the runtime in every period and throttles the thread once it is used up, 
+   * so best effort load can share the CPUs without starving the periodic. Period and 
+   * relative deadline are the period of the periodic. Without a runtime, the declared 
+   * execution time plus a margin is reserved, see \ref setExecutionTime. SCHED_DEADLINE 
+   * threads preempt all SCHED_FIFO threads. The kernel rejects SCHED_DEADLINE for threads 
+   * with a restricted CPU affinity, so the executor refuses to start if an affinity is set, 
+   * see \ref setAffinity. If the kernel rejects SCHED_DEADLINE anyway, the thread falls back 
+   * to SCHED_FIFO with its priority, the executor refuses to start if that fails too.
+   * 
+   * @param runtime - runtime in sec reserved per period, 0 to derive it from the execution time
+   */
+  void setDeadlineScheduling(double runtime = 0) {
+    deadlineScheduling = true;
+    deadlineRuntime = runtime;
+  }
+
+  /**
+   * Gets the deadline scheduling flag of the periodic.
+   * 
+   * @return true, if the thread runs with SCHED_DEADLINE
+   */
+  bool getDeadlineScheduling() {
+    return deadlineScheduling;
+  }
+
+  /**
+   * Gets the runtime reserved per period with SCHED_DEADLINE.
+   * 
+   * @return runtime in sec, 0 if derived from the execution time
+   */
+  double getDeadlineRuntime() {
+    return deadlineRuntime;
+  }
+
+  /**
+   * Makes the counter of the periodic record CPU time, page faults and context switches 
+   * of its thread per run, see \ref PeriodicCounter::setResourceAccounting. This tells 
+   * whether a long run was computation, preemption or paging, but costs a few 
+   * system calls per run.
+   * 
+   * @param value - true, to record resource usage
+   */
+  void setResourceAccounting(bool value) {
+    resourceAccounting = value;
+  }
+
+  /**
+   * Gets the resource accounting flag of the periodic.
+   * 
+   * @return resource accounting
+   */
+  bool getResourceAccounting() {
+    return resourceAccounting;
+  }
+
   /**
    * A periodic can be chosen to be run before another periodic.
    * In such a case you have to add it to this vector.
@@ -133,6 +270,13 @@ class Periodic {
   Runnable *task;
   bool realtime;
   int nice;
+  std::vector<int> affinity;
+  bool independent;
+  int phase;
+  double executionTime;
+  bool deadlineScheduling;
+  double deadlineRuntime;
+  bool resourceAccounting;
 };
 
 }
@@ -1,4 +1,6 @@
 #include <eeros/control/Block.hpp>
+#include <eeros/control/CycleContext.hpp>
+#include <algorithm>
 
 using namespace eeros::control;
 
@@ -8,4 +10,28 @@ void Block::setName(std::string name) {
 
 std::string Block::getName() const {
 	return name;
-}
\ No newline at end of file
+}
+
+const std::vector<InputInterface*>& Block::getInputs() const {
+	return inputs;
+}
+
+void Block::registerInput(InputInterface* input) {
+	if (std::find(inputs.begin(), inputs.end(), input) == inputs.end()) inputs.push_back(input);
+}
+
+void Block::unregisterInput(InputInterface* input) {
+	inputs.erase(std::remove(inputs.begin(), inputs.end(), input), inputs.end());
+}
+
+void Block::setAcquisitionTimestamps(bool value) {
+	acquisitionTimestamps = value;
+}
+
+bool Block::getAcquisitionTimestamps() const {
+	return acquisitionTimestamps;
+}
+
+timestamp_t Block::getTimestamp() const {
+	return acquisitionTimestamps ? System::getTimeNs() : CycleContext::now();
+}
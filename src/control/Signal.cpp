@@ -1,7 +1,8 @@
 #include <eeros/types.hpp>
+#include <atomic>
 
 namespace eeros {
 	namespace control {
-		uint16_t signalCounter = 1;
+		std::atomic<uint32_t> signalCounter(1);
 	};
 };
@@ -0,0 +1,68 @@
+#include <eeros/control/SignalRegistry.hpp>
+#include <algorithm>
+
+using namespace eeros::control;
+
+SignalRegistry& SignalRegistry::instance() {
+  static SignalRegistry registry;
+  return registry;
+}
+
+void SignalRegistry::add(SignalInterface* signal) {
+  std::lock_guard<std::mutex> lock(mtx);
+  ids[signal->getId()] = signal;
+  std::string name = signal->getName();
+  if (!name.empty()) names.emplace(name, signal);
+}
+
+void SignalRegistry::remove(SignalInterface* signal) {
+  std::lock_guard<std::mutex> lock(mtx);
+  auto i = ids.find(signal->getId());
+  if (i != ids.end() && i->second == signal) ids.erase(i);
+  auto range = names.equal_range(signal->getName());
+  for (auto n = range.first; n != range.second; n++) {
+    if (n->second == signal) {
+      names.erase(n);
+      break;
+    }
+  }
+}
+
+void SignalRegistry::rename(SignalInterface* signal, const std::string& oldName) {
+  std::lock_guard<std::mutex> lock(mtx);
+  auto range = names.equal_range(oldName);
+  for (auto n = range.first; n != range.second; n++) {
+    if (n->second == signal) {
+      names.erase(n);
+      break;
+    }
+  }
+  std::string name = signal->getName();
+  if (!name.empty()) names.emplace(name, signal);
+}
+
+SignalInterface* SignalRegistry::find(sigid_t id) {
+  std::lock_guard<std::mutex> lock(mtx);
+  auto i = ids.find(id);
+  return i != ids.end() ? i->second : nullptr;
+}
+
+SignalInterface* SignalRegistry::find(const std::string& name) {
+  std::lock_guard<std::mutex> lock(mtx);
+  auto n = names.find(name);
+  return n != names.end() ? n->second : nullptr;
+}
+
+std::vector<SignalInterface*> SignalRegistry::getSignals() {
+  std::lock_guard<std::mutex> lock(mtx);
+  std::vector<SignalInterface*> signals;
+  signals.reserve(ids.size());
+  for (auto& i : ids) signals.push_back(i.second);
+  std::sort(signals.begin(), signals.end(), [](SignalInterface* a, SignalInterface* b) { return a->getId() < b->getId(); });
+  return signals;
+}
+
+std::size_t SignalRegistry::size() {
+  std::lock_guard<std::mutex> lock(mtx);
+  return ids.size();
+}
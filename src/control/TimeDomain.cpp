@@ -1,9 +1,89 @@
 #include <eeros/control/TimeDomain.hpp>
+#include <eeros/control/Block.hpp>
+#include <eeros/control/CycleContext.hpp>
+#include <eeros/core/Tracer.hpp>
+#include <eeros/task/Async.hpp>
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+#include <functional>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace eeros::control;
 
+namespace {
+
+std::string blockName(Block* block) {
+  return block->getName().empty() ? "unnamed block" : block->getName();
+}
+
+// Tarjan's algorithm, assigns the index of its strongly connected component to each node
+struct Components {
+  Components(const std::vector<std::vector<std::size_t>> &successors) 
+      : successors(successors), component(successors.size(), none), index(successors.size(), none), 
+        low(successors.size(), 0), onStack(successors.size(), false) {
+    for (std::size_t v = 0; v < successors.size(); v++) {
+      if (index[v] == none) visit(v);
+    }
+  }
+  void visit(std::size_t v) {
+    index[v] = low[v] = counter++;
+    stack.push_back(v);
+    onStack[v] = true;
+    for (auto w : successors[v]) {
+      if (index[w] == none) {
+        visit(w);
+        low[v] = std::min(low[v], low[w]);
+      } else if (onStack[w]) {
+        low[v] = std::min(low[v], index[w]);
+      }
+    }
+    if (low[v] == index[v]) {
+      std::size_t w;
+      do {
+        w = stack.back();
+        stack.pop_back();
+        onStack[w] = false;
+        component[w] = count;
+      } while (w != v);
+      count++;
+    }
+  }
+  static constexpr std::size_t none = static_cast<std::size_t>(-1);
+  const std::vector<std::vector<std::size_t>> &successors;
+  std::vector<std::size_t> component, index, low, stack;
+  std::vector<bool> onStack;
+  std::size_t counter = 0, count = 0;
+};
+
+}
+
+// runs the share of one worker thread in all stages
+class TimeDomain::Worker : public Runnable {
+ public:
+  Worker(TimeDomain &td, unsigned thread) : td(td), thread(thread) { }
+  virtual void run() {
+    CycleContext::Scope cycle(td.cycleTime);
+    td.runStages(thread);
+  }
+ private:
+  TimeDomain &td;
+  unsigned thread;
+};
+
 TimeDomain::TimeDomain(std::string name, double period, bool realtime) 
-    : name(name), period(period), realtime(realtime), safetySystem(nullptr), safetyEvent(nullptr) { }
+    : name(name), traceName(eeros::Tracer::intern(name)), period(period), realtime(realtime), safetySystem(nullptr), safetyEvent(nullptr) { }
+
+TimeDomain::~TimeDomain() {
+  stopWorkers();
+}
+
+timestamp_t TimeDomain::getCycleTime() const {
+  return cycleTime;
+}
 
 std::string TimeDomain::getName() {
   return name;
@@ -24,8 +104,26 @@ void TimeDomain::registerSafetyEvent(SafetySystem& ss, SafetyEvent& e) {
 
 void TimeDomain::run() {
   if(!running) return;
+  eeros::Tracer::Span span(traceName);
+  cycleTime = System::getTimeNs();
+  CycleContext::Scope cycle(cycleTime);
   try {
-    for(auto block : blocks) block->run();
+    if(!sorted) {
+      // blocks added or removed after sorting run in the order they were added
+      if(!unsortedWarned) {
+        unsortedWarned = true;
+        logger::Logger::getLogger().warn() << "time domain '" << name << "' is not sorted, blocks run in the order they were added";
+      }
+      for(auto block : blocks) block->run();
+    } else if(workers.empty()) {
+      if(profiling.load(std::memory_order_relaxed)) {
+        for(std::size_t i = 0; i < schedule.size(); i++) runBlock(i);
+      } else {
+        for(auto block : schedule) block->run();
+      }
+    } else {
+      runParallel();
+    }
   } catch (NotConnectedFault const& e) {
     if(safetySystem != nullptr && safetyEvent != nullptr) {
       safetySystem->triggerEvent(*safetyEvent);
@@ -49,23 +147,338 @@ void TimeDomain::stop() {
 
 void TimeDomain::addBlock(eeros::Runnable* block) {
   blocks.push_back(block);
+  sorted = false;
+  validated = false;
 }
 
 void TimeDomain::addBlock(eeros::Runnable& block) {
   blocks.push_back(&block);
+  sorted = false;
+  validated = false;
 }
 
 void TimeDomain::removeBlock(eeros::Runnable* block) {
   blocks.remove(block);
+  sorted = false;
+  validated = false;
 }
 
 void TimeDomain::removeBlock(eeros::Runnable& block) {
   blocks.remove(&block);
+  sorted = false;
+  validated = false;
+}
+
+bool TimeDomain::freeze() {
+  bool frozen = true;
+  for (auto r : blocks) {
+    Block* block = dynamic_cast<Block*>(r);
+    if (block == nullptr) continue;
+    for (auto input : block->getInputs()) frozen = input->freeze() && frozen;
+  }
+  return frozen;
+}
+
+void TimeDomain::unfreeze() {
+  for (auto r : blocks) {
+    Block* block = dynamic_cast<Block*>(r);
+    if (block == nullptr) continue;
+    for (auto input : block->getInputs()) input->unfreeze();
+  }
+}
+
+std::size_t TimeDomain::validate() {
+  auto log = logger::Logger::getLogger();
+  std::size_t problems = 0;
+  std::unordered_set<Runnable*> added;
+  for (auto r : blocks) {
+    Block* block = dynamic_cast<Block*>(r);
+    if (!added.insert(r).second) {
+      log.warn() << "time domain '" << name << "': " << (block != nullptr ? "block '" + blockName(block) + "'" : "runnable") 
+                  << " is added more than once";
+      problems++;
+      continue;
+    }
+    if (block == nullptr) continue;
+    std::size_t i = 0;
+    for (auto input : block->getInputs()) {
+      if (!input->isConnected()) {
+        log.warn() << "time domain '" << name << "': input " << i << " of block '" << blockName(block) << "' is not connected";
+        problems++;
+      }
+      i++;
+    }
+  }
+  // inputs which are left unconnected on purpose keep checking their connection
+  freeze();
+  validated = (problems == 0);
+  if (!validated) log.warn() << "time domain '" << name << "': " << problems << " connection problems found";
+  return problems;
+}
+
+bool TimeDomain::isValidated() const {
+  return validated;
+}
+
+void TimeDomain::setParallel(unsigned threads, std::vector<int> cpus, int nice) {
+  if (threads > 1 && realtime && cpus.empty())
+    throw eeros::Fault("time domain '" + name + "': realtime worker threads must be pinned to CPUs");
+  if (threads > 1 && !cpus.empty()) {
+    // waiting workers sharing a CPU would keep each other from reaching the barrier
+    if (cpus.size() < threads - 1) 
+      throw eeros::Fault("time domain '" + name + "': " + std::to_string(threads - 1) + " worker threads need as many CPUs, got " + std::to_string(cpus.size()));
+    std::unordered_set<int> distinct(cpus.begin(), cpus.begin() + (threads - 1));
+    if (distinct.size() < threads - 1) 
+      throw eeros::Fault("time domain '" + name + "': worker threads must not share a CPU");
+  }
+  stopWorkers();
+  if (threads < 2) return;
+  barrier.reset(new SpinBarrier(threads));
+  errors.assign(threads, nullptr);
+  for (unsigned i = 1; i < threads; i++) {
+    workers.emplace_back(new Worker(*this, i));
+    std::vector<int> affinity;
+    if (!cpus.empty()) affinity.push_back(cpus[i - 1]);
+    workerThreads.emplace_back(new task::Async(*workers.back(), realtime, nice, affinity));
+  }
+  if (sorted) partition();
+}
+
+unsigned TimeDomain::getParallel() const {
+  return workers.size() + 1;
 }
 
-// void TimeDomain::sortBlocks() {
-// 	// TODO
-// }
+std::size_t TimeDomain::getStageCount() {
+  if (!sorted) sortBlocks();
+  return stages.size();
+}
+
+void TimeDomain::stopWorkers() {
+  workerThreads.clear();   // stops and joins the threads
+  workers.clear();
+  barrier.reset();
+  stages.clear();
+  errors.clear();
+}
+
+void TimeDomain::partition() {
+  stages.clear();
+  unsigned threads = workers.size() + 1;
+  auto singleThread = [](const Stage &stage) {
+    for (std::size_t t = 1; t < stage.parts.size(); t++) {
+      if (!stage.parts[t].empty()) return false;
+    }
+    return true;
+  };
+  auto addStage = [&](const std::vector<std::size_t> &runnables) {
+    Stage stage;
+    stage.parts.resize(threads);
+    for (std::size_t i = 0; i < runnables.size(); i++) stage.parts[i % threads].push_back(runnables[i]);
+    // consecutive stages run by the first thread only need no barrier in between
+    if (singleThread(stage) && !stages.empty() && singleThread(stages.back())) {
+      auto &part = stages.back().parts[0];
+      part.insert(part.end(), runnables.begin(), runnables.end());
+    } else {
+      stages.push_back(stage);
+    }
+  };
+  std::size_t begin = 0;
+  while (begin < schedule.size()) {
+    // blocks up to the next runnable which is not a block are split into levels
+    std::size_t end = begin;
+    while (end < schedule.size() && dynamic_cast<Block*>(schedule[end]) != nullptr) end++;
+    std::unordered_map<Block*, std::size_t> position;
+    for (std::size_t i = begin; i < end; i++) position.emplace(dynamic_cast<Block*>(schedule[i]), i - begin);
+    std::vector<std::size_t> level(end - begin, 0);
+    std::size_t levels = 0;
+    for (std::size_t i = 0; i < level.size(); i++) {
+      auto &inputs = dynamic_cast<Block*>(schedule[begin + i])->getInputs();
+      for (auto input : inputs) {
+        auto source = position.find(input->getSourceBlock());
+        if (source != position.end() && source->second < i) level[i] = std::max(level[i], level[source->second] + 1);
+      }
+      // a source running later is read from the previous cycle, so it must not run before this block
+      for (auto input : inputs) {
+        auto source = position.find(input->getSourceBlock());
+        if (source != position.end() && source->second > i) level[source->second] = std::max(level[source->second], level[i] + 1);
+      }
+      levels = std::max(levels, level[i] + 1);
+    }
+    std::vector<std::vector<std::size_t>> byLevel(levels);
+    for (std::size_t i = 0; i < level.size(); i++) byLevel[level[i]].push_back(begin + i);
+    for (auto &l : byLevel) addStage(l);
+    if (end < schedule.size()) addStage({end});
+    begin = end + 1;
+  }
+}
+
+void TimeDomain::runStages(unsigned thread) {
+  for (auto &stage : stages) {
+    if (!failed.load(std::memory_order_relaxed)) {
+      try {
+        if (profiling.load(std::memory_order_relaxed)) {
+          for (auto i : stage.parts[thread]) runBlock(i);
+        } else {
+          for (auto i : stage.parts[thread]) schedule[i]->run();
+        }
+      } catch (...) {
+        errors[thread] = std::current_exception();
+        failed = true;
+      }
+    }
+    barrier->wait();
+  }
+}
+
+void TimeDomain::runParallel() {
+  failed = false;
+  for (auto &t : workerThreads) t->run();
+  runStages(0);
+  if (!failed) return;
+  // rethrow the fault of the thread with the lowest number, so always the same fault is reported
+  std::exception_ptr error;
+  for (auto &e : errors) {
+    if (e != nullptr && error == nullptr) error = e;
+    e = nullptr;
+  }
+  std::rethrow_exception(error);
+}
+
+void TimeDomain::runBlock(std::size_t i) {
+  auto start = std::chrono::steady_clock::now();
+  schedule[i]->run();
+  double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  profiles[i].run.add(time);
+  profiles[i].histogram.add(time);
+}
+
+void TimeDomain::setProfiling(bool value) {
+  profiling = value;
+}
+
+bool TimeDomain::getProfiling() const {
+  return profiling;
+}
+
+void TimeDomain::resetProfile() {
+  for (auto &p : profiles) {
+    p.run.reset();
+    p.histogram.reset();
+  }
+}
+
+std::vector<const TimeDomain::BlockProfile*> TimeDomain::getProfile(bool byWorstCase) {
+  std::vector<const BlockProfile*> ranking;
+  for (auto &p : profiles) ranking.push_back(&p);
+  std::stable_sort(ranking.begin(), ranking.end(), [byWorstCase](const BlockProfile *a, const BlockProfile *b) {
+    return byWorstCase ? a->run.max > b->run.max : a->run.mean > b->run.mean;
+  });
+  return ranking;
+}
+
+void TimeDomain::reportProfile(logger::Logger &log, std::size_t count) {
+  double total = 0;
+  for (auto &p : profiles) total += p.run.count > 0 ? p.run.mean : 0;
+  for (bool byWorstCase : {false, true}) {
+    auto ranking = getProfile(byWorstCase);
+    if (count > 0 && ranking.size() > count) ranking.resize(count);
+    std::ostringstream table;
+    table << std::fixed;
+    table << "time domain '" << name << "': blocks ranked by " << (byWorstCase ? "maximum" : "mean") << " run time in us" << std::endl;
+    table << "     mean       p99       max   share    count  block";
+    for (auto p : ranking) {
+      if (p->run.count == 0) continue;
+      table << std::endl << std::setprecision(2) << std::setw(9) << p->run.mean * 1e6 << ' ' << std::setw(9) << p->histogram.percentile(99) * 1e6 
+            << ' ' << std::setw(9) << p->run.max * 1e6 << ' ' << std::setprecision(1) << std::setw(6) << (total > 0 ? p->run.mean / total * 100 : 0) 
+            << "% " << std::setw(8) << p->run.count << "  " << p->name;
+    }
+    log.info() << table.str();
+  }
+}
+
+std::size_t TimeDomain::sortBlocks() {
+  std::vector<Runnable*> order(blocks.begin(), blocks.end());
+  std::vector<Runnable*> result;
+  result.reserve(order.size());
+  std::size_t begin = 0;
+  while (begin < order.size()) {
+    // sort the blocks up to the next runnable which is not a block
+    std::size_t end = begin;
+    while (end < order.size() && dynamic_cast<Block*>(order[end]) != nullptr) end++;
+    std::size_t n = end - begin;
+    std::unordered_map<Block*, std::size_t> index;
+    for (std::size_t i = 0; i < n; i++) index.emplace(static_cast<Block*>(dynamic_cast<Block*>(order[begin + i])), i);
+    std::vector<std::vector<std::size_t>> successors(n);
+    for (std::size_t i = 0; i < n; i++) {
+      for (auto input : dynamic_cast<Block*>(order[begin + i])->getInputs()) {
+        auto source = index.find(input->getSourceBlock());
+        if (source != index.end() && source->second != i) successors[source->second].push_back(i);
+      }
+    }
+    // blocks in a loop keep the order in which they were added, so connections 
+    // within a loop to a block added earlier are read from the previous cycle
+    Components loops(successors);
+    std::vector<int> predecessors(n, 0);
+    for (std::size_t i = 0; i < n; i++) {
+      auto &s = successors[i];
+      s.erase(std::remove_if(s.begin(), s.end(), [&] (std::size_t j) { 
+        return j < i && loops.component[j] == loops.component[i]; 
+      }), s.end());
+      for (auto j : s) predecessors[j]++;
+    }
+    // among all blocks ready to run, the one added first runs first
+    std::priority_queue<std::size_t, std::vector<std::size_t>, std::greater<std::size_t>> ready;
+    for (std::size_t i = 0; i < n; i++) {
+      if (predecessors[i] == 0) ready.push(i);
+    }
+    while (!ready.empty()) {
+      std::size_t i = ready.top();
+      ready.pop();
+      result.push_back(order[begin + i]);
+      for (auto s : successors[i]) {
+        if (--predecessors[s] == 0) ready.push(s);
+      }
+    }
+    if (end < order.size()) result.push_back(order[end]);
+    begin = end + 1;
+  }
+
+  // report blocks which were moved and connections which are still read before they are written
+  std::unordered_map<Runnable*, std::size_t> added, position;
+  for (std::size_t i = 0; i < order.size(); i++) added.emplace(order[i], i);
+  for (std::size_t i = 0; i < result.size(); i++) position.emplace(result[i], i);
+  auto log = logger::Logger::getLogger();
+  std::size_t delays = 0;
+  for (auto r : result) {
+    Block* block = dynamic_cast<Block*>(r);
+    if (block == nullptr) continue;
+    for (auto input : block->getInputs()) {
+      Block* source = input->getSourceBlock();
+      if (source == nullptr || position.find(source) == position.end()) continue;
+      if (position[source] >= position[block]) {
+        delays++;
+        log.info() << "time domain '" << name << "': '" << blockName(block) << "' reads the output of '" 
+                   << blockName(source) << "' from the previous cycle";
+      } else if (added[source] > added[block]) {
+        log.info() << "time domain '" << name << "': '" << blockName(block) << "' moved after '" 
+                   << blockName(source) << "' to remove a delay of one cycle";
+      }
+    }
+  }
+  schedule = result;
+  // allocated also without profiling, so it can be switched on while running
+  profiles.clear();
+  profiles.resize(schedule.size());
+  for (std::size_t i = 0; i < schedule.size(); i++) {
+    Block* block = dynamic_cast<Block*>(schedule[i]);
+    profiles[i].block = schedule[i];
+    profiles[i].name = block != nullptr ? blockName(block) : "runnable";
+  }
+  if (!workers.empty()) partition();
+  sorted = true;
+  unsortedWarned = false;
+  return delays;
+}
 
 namespace eeros {
 namespace control {
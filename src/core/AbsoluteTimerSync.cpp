@@ -0,0 +1,52 @@
+#include <eeros/core/AbsoluteTimerSync.hpp>
+#include <stdexcept>
+#include <cerrno>
+
+using namespace eeros;
+
+AbsoluteTimerSync::AbsoluteTimerSync(clockid_t clock, double busyWaitTime) 
+    : periodNs(0), nextCycle(0) {
+  setClock(clock);
+  setBusyWaitTime(busyWaitTime);
+}
+
+void AbsoluteTimerSync::setClock(clockid_t clock) {
+  struct timespec ts;
+  if (clock == CLOCK_MONOTONIC_RAW || clock_getres(clock, &ts) != 0)
+    throw std::runtime_error("clock can't be used for periodic execution");
+  this->clock = clock;
+}
+
+void AbsoluteTimerSync::setBusyWaitTime(double busyWaitTime) {
+  if (busyWaitTime < 0) throw std::runtime_error("busy wait time must not be negative");
+  spinTimeNs = static_cast<int64_t>(busyWaitTime * NS_PER_SEC);
+}
+
+double AbsoluteTimerSync::getBusyWaitTime() {
+  return static_cast<double>(spinTimeNs) / NS_PER_SEC;
+}
+
+void AbsoluteTimerSync::start(double period) {
+  SyncSource::start(period);
+  periodNs = static_cast<int64_t>(period * NS_PER_SEC);
+  nextCycle = now(clock) + periodNs;
+}
+
+bool AbsoluteTimerSync::wait() {
+  struct timespec wakeup = toTimespec(nextCycle - spinTimeNs);
+  while (clock_nanosleep(clock, TIMER_ABSTIME, &wakeup, nullptr) == EINTR && !stopped);
+  if (spinTimeNs > 0) {
+    while (now(clock) < nextCycle && !stopped);
+  }
+  nextCycle += periodNs;
+  return !stopped;
+}
+
+double AbsoluteTimerSync::getLateness() {
+  return static_cast<double>(now(clock) - nextCycle) / NS_PER_SEC;
+}
+
+void AbsoluteTimerSync::resync() {
+  int64_t latenessNs = now(clock) - nextCycle;
+  if (latenessNs >= 0) nextCycle += (latenessNs / periodNs + 1) * periodNs;
+}
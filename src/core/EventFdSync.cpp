@@ -0,0 +1,35 @@
+#include <eeros/core/EventFdSync.hpp>
+#include <stdexcept>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+using namespace eeros;
+
+EventFdSync::EventFdSync() {
+  fd = eventfd(0, EFD_CLOEXEC | EFD_SEMAPHORE);
+  if (fd < 0) throw std::runtime_error("could not create eventfd");
+}
+
+EventFdSync::~EventFdSync() {
+  close(fd);
+}
+
+bool EventFdSync::wait() {
+  uint64_t value;
+  while (read(fd, &value, sizeof(value)) != sizeof(value) && !stopped);
+  return !stopped;
+}
+
+void EventFdSync::stop() {
+  SyncSource::stop();
+  trigger();
+}
+
+void EventFdSync::trigger() {
+  uint64_t value = 1;
+  if (write(fd, &value, sizeof(value)) != sizeof(value)) { }   // counter overflow, nothing to do
+}
+
+int EventFdSync::getFd() {
+  return fd;
+}
@@ -3,17 +3,28 @@
 #include <chrono>
 #include <vector>
 #include <memory>
+#include <sstream>
 #include <cmath>
+#include <numeric>
+#include <limits>
 #include <thread>
+#include <cerrno>
 #include <signal.h>
 #include <sched.h>
+#include <time.h>
 #include <sys/mman.h>
 #include <sys/syscall.h>
 #include <unistd.h>
 #include <eeros/core/Executor.hpp>
+#include <eeros/core/System.hpp>
+#include <eeros/core/Tracer.hpp>
+#include <eeros/core/SimulatedTimeSync.hpp>
+#include <eeros/core/PollingSync.hpp>
+#include <eeros/core/SchedulabilityAnalysis.hpp>
 #include <eeros/task/Async.hpp>
 #include <eeros/task/Lambda.hpp>
 #include <eeros/task/HarmonicTaskList.hpp>
+#include <eeros/task/ForkJoin.hpp>
 #include <eeros/control/TimeDomain.hpp>
 #include <eeros/safety/SafetySystem.hpp>
 #ifdef USE_ROS
@@ -28,12 +39,165 @@ namespace {
 
 using Logger = logger::Logger;
 
+constexpr double readyTimeout = 5.0;   // sec
+constexpr int maxHyperperiod = 100000; // base ticks
+constexpr double budgetMargin = 1.25;   // runtime reserved with SCHED_DEADLINE relative to the execution time
+
+#ifndef SCHED_DEADLINE
+#define SCHED_DEADLINE 6
+#endif
+
+// layout of struct sched_attr, which older C libraries do not declare
+struct DeadlineAttr {
+  uint32_t size;
+  uint32_t sched_policy;
+  uint64_t sched_flags;
+  int32_t sched_nice;
+  uint32_t sched_priority;
+  uint64_t sched_runtime;
+  uint64_t sched_deadline;
+  uint64_t sched_period;
+};
+
+#ifdef USE_ETHERCAT
+class EtherCatSync : public SyncSource {
+ public:
+  EtherCatSync(ecmasterlib::EcMasterlibMain* stack) : stack(stack) { }
+  virtual bool wait() {
+    stack->sync();
+    return !stopped;
+  }
+ private:
+  ecmasterlib::EcMasterlibMain* stack;
+};
+#endif
+
+#ifdef USE_ROS
+// ROS 1 offers no blocking wait for new messages and time, so this source polls
+class RosTopicSync : public SyncSource {
+ public:
+  RosTopicSync(ros::CallbackQueue* queue) : queue(queue), first(true) { }
+  virtual bool wait() {
+    if (first) {
+      timeOld = ros::Time::now();
+      timeNew = ros::Time::now();
+      while (timeOld == timeNew && !stopped) {	// waits for new rosTime beeing published
+        usleep(10);
+        timeNew = ros::Time::now();
+      }
+      first = false;
+      timeOld = timeNew;
+    }
+    while (queue->isEmpty() && !stopped) usleep(10);	// waits for new message
+    while (timeOld == timeNew && !stopped) {		// waits for new rosTime beeing published
+      usleep(10);
+      timeNew = ros::Time::now();
+    }
+    timeOld = timeNew;
+    queue->callAvailable();
+    return !stopped;
+  }
+ private:
+  ros::CallbackQueue* queue;
+  bool first;
+  ros::Time timeOld, timeNew;
+};
+#endif
+
+std::string cpuList(const std::vector<int> &cpus) {
+  if (cpus.empty()) return "unknown";
+  std::ostringstream s;
+  for (std::size_t i = 0; i < cpus.size(); i++) s << (i > 0 ? "," : "") << cpus[i];
+  return s.str();
+}
+
+// runtime reserved with SCHED_DEADLINE, 0 for SCHED_FIFO
+double deadlineRuntime(task::Periodic &task) {
+  if (!task.getDeadlineScheduling()) return 0;
+  if (task.getDeadlineRuntime() > 0) return task.getDeadlineRuntime();
+  return task.getExecutionTime() * budgetMargin;
+}
+
+int divisor(task::Periodic &task, double basePeriod) {
+  return static_cast<int>(task.getPeriod() / basePeriod);
+}
+
+// number of base ticks after which the phases of all tasks repeat, bounded
+int hyperperiod(const std::vector<int> &k) {
+  long ticks = 1;
+  for (int n: k) {
+    ticks = ticks / std::gcd(ticks, static_cast<long>(n)) * n;
+    if (ticks > maxHyperperiod) return maxHyperperiod;
+  }
+  return static_cast<int>(ticks);
+}
+
+// sum of the loads of all tasks running on each base tick of the hyperperiod
+std::vector<double> tickLoad(const std::vector<int> &k, const std::vector<int> &phase, const std::vector<double> &load) {
+  std::vector<double> ticks(hyperperiod(k), 0.0);
+  for (std::size_t i = 0; i < k.size(); i++) {
+    for (std::size_t t = phase[i]; t < ticks.size(); t += k[i]) ticks[t] += load[i];
+  }
+  return ticks;
+}
+
+// chooses a phase for each task with a negative phase, heaviest task first, 
+// such that the worst tick it runs on carries the least load (and tasks) so far
+std::vector<int> spreadPhases(const std::vector<int> &k, const std::vector<int> &phase, const std::vector<double> &load) {
+  std::vector<int> result(phase);
+  std::vector<std::size_t> order(k.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&] (std::size_t a, std::size_t b) {
+    if ((phase[a] < 0) != (phase[b] < 0)) return phase[a] >= 0;
+    if (load[a] != load[b]) return load[a] > load[b];
+    return k[a] > k[b];
+  });
+  std::vector<double> ticks(hyperperiod(k), 0.0);
+  std::vector<int> count(ticks.size(), 0);
+  for (auto i: order) {
+    if (result[i] < 0) {
+      double bestLoad = std::numeric_limits<double>::infinity();
+      int bestCount = std::numeric_limits<int>::max();
+      for (int p = 0; p < k[i]; p++) {
+        double worstLoad = 0;
+        int worstCount = 0;
+        for (std::size_t t = p; t < ticks.size(); t += k[i]) {
+          worstLoad = std::max(worstLoad, ticks[t]);
+          worstCount = std::max(worstCount, count[t]);
+        }
+        if (worstLoad < bestLoad || (worstLoad == bestLoad && worstCount < bestCount)) {
+          bestLoad = worstLoad;
+          bestCount = worstCount;
+          result[i] = p;
+        }
+      }
+    }
+    for (std::size_t t = result[i]; t < ticks.size(); t += k[i]) {
+      ticks[t] += load[i];
+      count[t]++;
+    }
+  }
+  return result;
+}
+
+double worst(const std::vector<double> &ticks) {
+  return ticks.empty() ? 0.0 : *std::max_element(ticks.begin(), ticks.end());
+}
+
+double average(const std::vector<double> &ticks) {
+  return ticks.empty() ? 0.0 : std::accumulate(ticks.begin(), ticks.end(), 0.0) / ticks.size();
+}
+
 struct TaskThread {
   TaskThread(double period, task::Periodic &task, task::HarmonicTaskList tasks) 
-      : taskList(tasks), async(taskList, task.getRealtime(), task.getNice()) {
+      : name(task.getName()), periodic(&task), taskList(tasks), 
+        async(taskList, task.getRealtime(), task.getNice(), task.getAffinity(), deadlineRuntime(task), period) {
     async.counter.setPeriod(period);
     async.counter.monitors = task.monitors;
+    async.counter.setResourceAccounting(task.getResourceAccounting());
   }
+  std::string name;
+  task::Periodic *periodic;
   task::HarmonicTaskList taskList;
   task::Async async;
 };
@@ -47,36 +211,55 @@ void traverse(std::vector<task::Periodic> &tasks, F func) {
   }
 }
 
-void createThread(Logger &log, task::Periodic &task, task::Periodic &baseTask, std::vector<std::shared_ptr<TaskThread>> &threads, std::vector<task::Harmonic> &output);
+using ForkJoinList = std::vector<std::shared_ptr<task::ForkJoin>>;
+
+std::pair<task::Async*, int> createThread(Logger &log, task::Periodic &task, task::Periodic &baseTask, std::vector<std::shared_ptr<TaskThread>> &threads, ForkJoinList &forks);
 
-void createThreads(Logger &log, std::vector<task::Periodic> &tasks, task::Periodic &baseTask, std::vector<std::shared_ptr<TaskThread>> &threads, task::HarmonicTaskList &output) {
+void createThreads(Logger &log, std::vector<task::Periodic> &tasks, task::Periodic &baseTask, std::vector<std::shared_ptr<TaskThread>> &threads, ForkJoinList &forks, task::HarmonicTaskList &output) {
+  std::shared_ptr<task::ForkJoin> fork;
   for (task::Periodic &t: tasks) {
-    createThread(log, t, baseTask, threads, output.tasks);
+    auto async = createThread(log, t, baseTask, threads, forks);
+    if (t.getIndependent()) {
+      if (fork == nullptr) fork = std::make_shared<task::ForkJoin>();
+      fork->add(*async.first, async.second, std::max(t.getPhase(), 0));
+    } else {
+      output.add(async.first, async.second, std::max(t.getPhase(), 0));
+    }
+  }
+  // independent tasks run in parallel after all others were triggered, 
+  // they are joined before the list continues
+  if (fork != nullptr) {
+    forks.push_back(fork);
+    output.add(fork.get());
   }
 }
 
-void createThread(Logger &log, task::Periodic &task, task::Periodic &baseTask, std::vector<std::shared_ptr<TaskThread>> &threads, std::vector<task::Harmonic> &output) {
-  int k = static_cast<int>(task.getPeriod() / baseTask.getPeriod());
+std::pair<task::Async*, int> createThread(Logger &log, task::Periodic &task, task::Periodic &baseTask, std::vector<std::shared_ptr<TaskThread>> &threads, ForkJoinList &forks) {
+  int k = divisor(task, baseTask.getPeriod());
   double actualPeriod = k * baseTask.getPeriod();
   double deviation = std::abs(task.getPeriod() - actualPeriod) / task.getPeriod();
   task::HarmonicTaskList taskList;
 
   if (task.before.size() > 0) {
-    createThreads(log, task.before, task, threads, taskList);
+    createThreads(log, task.before, task, threads, forks, taskList);
   }
   taskList.add(task.getTask());
   if (task.after.size() > 0) {
-    createThreads(log, task.after, task, threads, taskList);
+    createThreads(log, task.after, task, threads, forks, taskList);
   }
 
   if (task.getRealtime())
     log.trace() << "creating harmonic realtime task '" << task.getName()
           << "' with period " << actualPeriod << " sec (k = "
-          << k << ") and priority " << ((int)(Executor::basePriority) - task.getNice())
+          << k << ", phase " << std::max(task.getPhase(), 0) << ") and priority " << ((int)(Executor::basePriority) - task.getNice())
+          << " on cpus " << (task.getAffinity().empty() ? "any" : cpuList(task.getAffinity()))
+          << (task.getIndependent() ? " as independent task" : "")
           << " based on '" << baseTask.getName() << "'";
   else
     log.trace() << "creating harmonic task '" << task.getName() << "' with period "
-          << actualPeriod << " sec (k = " << k << ")"
+          << actualPeriod << " sec (k = " << k << ", phase " << std::max(task.getPhase(), 0) << ")"
+          << " on cpus " << (task.getAffinity().empty() ? "any" : cpuList(task.getAffinity()))
+          << (task.getIndependent() ? " as independent task" : "")
           << " based on '" << baseTask.getName() << "'";
 
   if (deviation > 0.01) throw std::runtime_error("period deviation too high");
@@ -84,17 +267,27 @@ void createThread(Logger &log, task::Periodic &task, task::Periodic &baseTask, s
   if (task.getRealtime() && task.getNice() <= 0)
     throw std::runtime_error("priority not set");
 
+  if (task.getDeadlineScheduling()) {
+    double runtime = deadlineRuntime(task);
+    if (runtime <= 0) throw std::runtime_error("deadline scheduling of '" + task.getName() + "' needs a runtime or an execution time");
+    if (runtime > actualPeriod) throw std::runtime_error("runtime of '" + task.getName() + "' exceeds its period");
+    if (!task.getRealtime()) log.warn() << "deadline scheduling of '" << task.getName() << "' ignored, it is not a realtime task";
+    else if (!task.getAffinity().empty()) throw std::runtime_error("deadline scheduling of '" + task.getName() + "' cannot be combined with a CPU affinity");
+    else log.trace() << "reserving " << runtime * 1e6 << " us per period for '" << task.getName() << "' with SCHED_DEADLINE";
+  }
+
   if (taskList.tasks.size() == 0)
     throw std::runtime_error("no task to execute");
 
   threads.push_back(std::make_shared<TaskThread>(actualPeriod, task, taskList));
-  output.emplace_back(threads.back()->async, k);
+  return {&threads.back()->async, k};
 }
 }
 
 Executor::Executor() 
-    : period(0), mainTask(nullptr), syncWithEtherCatStackSet(false),
-      syncWithRosTimeSet(false), syncWithRosTopicSet(false),
+    : period(0), syncSource(nullptr), activeSyncSource(nullptr), overrunPolicy(OverrunPolicy::catchUp), maxCatchUp(0),
+      schedulabilityCheck(SchedulabilityCheck::warn), autoPhase(false), safetySystem(nullptr), safetyEvent(nullptr), mainTask(nullptr), syncWithEtherCatStackSet(false),
+      syncWithRosTimeSet(false), syncWithRosTopicSet(false), simulatedTimeSet(false), simulationDuration(0),
       log(logger::Logger::getLogger('E')) { }
 
 Executor::~Executor() { }
@@ -152,6 +345,208 @@ void Executor::add(control::TimeDomain &td) {
   tasks.push_back(task);
 }
 
+void Executor::setSyncSource(SyncSource &source) {
+  syncSource = &source;
+}
+
+void Executor::setClock(clockid_t clock) {
+  timer.setClock(clock);
+}
+
+void Executor::setBusyWaitTime(double spinTime) {
+  timer.setBusyWaitTime(spinTime);
+}
+
+void Executor::useSimulatedTime(double duration) {
+  if (duration < 0) throw std::runtime_error("simulation duration must not be negative");
+  simulatedTimeSet = true;
+  simulationDuration = duration;
+  // sequences started before the executor runs take part in the simulation
+  System::useSimulatedTime();
+}
+
+void Executor::setOverrunPolicy(OverrunPolicy policy, int maxCatchUp) {
+  if (maxCatchUp < 0) throw std::runtime_error("number of cycles to catch up must not be negative");
+  overrunPolicy = policy;
+  this->maxCatchUp = maxCatchUp;
+}
+
+void Executor::registerSafetyEvent(safety::SafetySystem &ss, safety::SafetyEvent &e) {
+  safetySystem = &ss;
+  safetyEvent = &e;
+}
+
+SyncSource& Executor::selectSyncSource() {
+  int sources = (syncSource != nullptr) + syncWithEtherCatStackSet + syncWithRosTimeSet + syncWithRosTopicSet + simulatedTimeSet;
+  if (sources > 1) log.error() << "Can't use several sync sources at once, only one is used";
+  ownSyncSource.reset();
+  if (syncSource != nullptr) {
+    log.trace() << "starting execution synched to user defined sync source";
+    return *syncSource;
+  }
+  if (simulatedTimeSet) {
+    log.trace() << "starting execution with simulated time";
+    ownSyncSource.reset(new SimulatedTimeSync(simulationDuration));
+    return *ownSyncSource;
+  }
+#ifdef USE_ETHERCAT
+  if (syncWithEtherCatStackSet) {
+    log.trace() << "starting execution synched to etcherCAT stack";
+    ownSyncSource.reset(new EtherCatSync(etherCATStack));
+    return *ownSyncSource;
+  }
+#endif
+#if defined USE_ROS || defined USE_ROS2
+  if (syncWithRosTimeSet) {
+    log.trace() << "starting execution synched to rosTime";
+    // ROS time can only be polled
+    uint64_t periodNsec = static_cast<uint64_t>(period * 1.0e9);
+    auto nextCycle = std::make_shared<uint64_t>(System::getTimeNs() + periodNsec);
+    ownSyncSource.reset(new PollingSync([nextCycle, periodNsec]() {
+      if (System::getTimeNs() < *nextCycle) return false;
+      *nextCycle += periodNsec;
+      return true;
+    }));
+    return *ownSyncSource;
+  }
+#endif
+#ifdef USE_ROS
+  if (syncWithRosTopicSet) {
+    log.trace() << "starting execution synched to gazebo";
+    ownSyncSource.reset(new RosTopicSync(syncRosCallbackQueue));
+    return *ownSyncSource;
+  }
+#endif
+#ifdef USE_ROS2
+  if (syncWithRosTopicSet) {
+    log.trace() << "starting execution synched to gazebo";
+    return rosTopicSync;
+  }
+#endif
+  log.trace() << "starting periodic execution";
+  if (timer.getBusyWaitTime() > 0) log.trace() << "busy waiting the last " << timer.getBusyWaitTime() * 1e6 << " us of each cycle";
+  return timer;
+}
+
+void Executor::handleOverrun(SyncSource &source) {
+  double lateness = source.getLateness();
+  counter.checkDeadline(lateness);
+  if (lateness <= 0) return;
+  switch (overrunPolicy) {
+    case OverrunPolicy::catchUp:
+      if (maxCatchUp == 0 || counter.consecutiveOverruns <= maxCatchUp) return;
+      break;
+    case OverrunPolicy::safetyEvent:
+      if (safetySystem != nullptr && safetyEvent != nullptr) safetySystem->triggerEvent(*safetyEvent);
+      break;
+    case OverrunPolicy::skip:
+      break;
+  }
+  // drop the missed cycles and continue with the next deadline in the future
+  source.resync();
+}
+
+void Executor::setAutoPhase(bool value) {
+  autoPhase = value;
+}
+
+void Executor::balancePhases() {
+  std::lock_guard<std::mutex> lock(phaseMutex);
+  if (phases.empty()) {
+    log.warn() << "no harmonic tasks running, phases not balanced";
+    return;
+  }
+  std::vector<int> k, current = phaseTable.get(), phase;
+  std::vector<double> load;
+  for (std::size_t i = 0; i < phases.size(); i++) {
+    auto &e = phases[i];
+    k.push_back(e.harmonic->getDivisor());
+    phase.push_back(e.fixed ? current[i] : -1);
+    load.push_back(e.counter->run.count > 0 ? e.counter->run.max : e.periodic->getExecutionTime());
+  }
+  auto observed = tickLoad(k, current, load);
+  phase = spreadPhases(k, phase, load);
+  auto predicted = tickLoad(k, phase, load);
+  phaseTable.set(phase);
+  log.info() << "phases balanced with measured run times, worst case tick load " << worst(observed) * 1000 
+             << " ms observed, " << worst(predicted) * 1000 << " ms predicted";
+}
+
+void Executor::assignPhases() {
+  std::vector<int> k, phase;
+  std::vector<double> load;
+  for (auto &t: tasks) {
+    k.push_back(divisor(t, period));
+    phase.push_back(autoPhase ? t.getPhase() : std::max(t.getPhase(), 0));
+    if (phase.back() >= k.back()) throw std::runtime_error("phase of '" + t.getName() + "' must be smaller than its divisor");
+    load.push_back(t.getExecutionTime());
+  }
+  phase = spreadPhases(k, phase, load);
+  for (std::size_t i = 0; i < tasks.size(); i++) tasks[i].setPhase(phase[i]);
+  auto ticks = tickLoad(k, phase, load);
+  if (worst(ticks) > 0)
+    log.info() << "predicted worst case tick load " << worst(ticks) * 1000 << " ms, average "
+               << average(ticks) * 1000 << " ms over " << ticks.size() << " ticks";
+}
+
+void Executor::setSchedulabilityCheck(SchedulabilityCheck check) {
+  schedulabilityCheck = check;
+}
+
+bool Executor::checkSchedulability() {
+  // the threads are only valid while the executor runs, copy their measurements
+  std::vector<std::pair<task::Periodic*, double>> measurements;
+  {
+    std::lock_guard<std::mutex> lock(phaseMutex);
+    for (auto &t: taskThreads) {
+      if (t.second->counter.run.count > 0) measurements.push_back({t.first, t.second->counter.run.max});
+    }
+  }
+  auto executionTime = [&measurements] (task::Periodic *task, PeriodicCounter *counter) {
+    double measured = (counter != nullptr && counter->run.count > 0) ? counter->run.max : 0.0;
+    for (auto &m: measurements) {
+      if (m.first == task) measured = m.second;
+    }
+    return std::max({task->getExecutionTime(), measured, deadlineRuntime(*task)});
+  };
+  SchedulabilityAnalysis analysis;
+  if (mainTask != nullptr)
+    analysis.add(mainTask->getName(), period, executionTime(mainTask, &counter), basePriority, affinity);
+  traverse(tasks, [&] (task::Periodic *task) {
+    // deadline threads preempt all fifo threads
+    int priority = task->getDeadlineScheduling() ? basePriority + 1 : basePriority - task->getNice();
+    if (task->getRealtime()) 
+      analysis.add(task->getName(), task->getPeriod(), executionTime(task, nullptr), priority, task->getAffinity());
+  });
+  bool schedulable = analysis.analyse();
+  for (auto &t: analysis.getTasks()) {
+    std::ostringstream s;
+    s << "schedulability of '" << t.name << "' (priority " << t.priority << "): execution time " << t.wcet * 1000 
+      << " ms, utilisation " << t.utilisation * 100 << " %, response time " << t.responseTime * 1000 
+      << " ms, deadline " << t.period * 1000 << " ms";
+    if (t.schedulable) log.info() << s.str();
+    else log.warn() << s.str() << ", may miss its deadline";
+  }
+  log.info() << "total utilisation of realtime tasks " << analysis.getUtilisation() * 100 << " %";
+  return schedulable;
+}
+
+void Executor::adaptDeadlineBudgets() {
+  // run() empties the list before it stops the threads, so every listed thread is alive
+  std::lock_guard<std::mutex> lock(phaseMutex);
+  for (auto &t: taskThreads) {
+    task::Periodic &task = *t.first;
+    if (!task.getDeadlineScheduling() || !task.getRealtime() || t.second->counter.run.count == 0) continue;
+    if (t.second->getThreadId() == 0) continue;
+    double period = t.second->counter.getPeriod();
+    double runtime = std::min(std::max(deadlineRuntime(task), t.second->counter.run.max * budgetMargin), period);
+    if (set_deadline(runtime, period, period, t.second->getThreadId()))
+      log.info() << "reserving " << runtime * 1e6 << " us per period for '" << task.getName() << "'";
+    else
+      log.error() << "could not adapt runtime of '" << task.getName() << "'";
+  }
+}
+
 void Executor::prefault_stack() {
   unsigned char dummy[8*1024] = {};
     (void)dummy;
@@ -167,6 +562,53 @@ bool Executor::set_priority(int nice) {
   return (sched_setscheduler(0, SCHED_FIFO, &schedulingParam) != -1);
 }
 
+bool Executor::set_affinity(const std::vector<int> &cpus) {
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (int cpu: cpus) {
+    if (cpu < 0 || cpu >= CPU_SETSIZE) return false;
+    CPU_SET(cpu, &set);
+  }
+  return (sched_setaffinity(0, sizeof(set), &set) != -1);
+}
+
+bool Executor::set_deadline(double runtime, double deadline, double period, pid_t thread) {
+  DeadlineAttr attr = {};
+  attr.size = sizeof(attr);
+  attr.sched_policy = SCHED_DEADLINE;
+  attr.sched_runtime = static_cast<uint64_t>(runtime * 1e9);
+  attr.sched_deadline = static_cast<uint64_t>(deadline * 1e9);
+  attr.sched_period = static_cast<uint64_t>(period * 1e9);
+  return (syscall(SYS_sched_setattr, thread, &attr, 0) != -1);
+}
+
+std::vector<int> Executor::get_affinity(pthread_t thread) {
+  std::vector<int> cpus;
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (pthread_getaffinity_np(thread, sizeof(set), &set) != 0) return cpus;
+  for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+    if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+  }
+  return cpus;
+}
+
+void Executor::setAffinity(std::vector<int> cpus) {
+  affinity = cpus;
+}
+
+void Executor::setTaskAffinity(std::vector<int> cpus) {
+  taskAffinity = cpus;
+}
+
+void Executor::assignAffinities() {
+  if (taskAffinity.empty()) return;
+  traverse(tasks, [this] (task::Periodic *task) {
+    // the kernel rejects SCHED_DEADLINE for threads with a restricted affinity
+    if (task->getAffinity().empty() && !(task->getDeadlineScheduling() && task->getRealtime())) task->setAffinity(taskAffinity);
+  });
+}
+
 void Executor::assignPriorities() {
   std::vector<task::Periodic*> priorityAssignments;
 
@@ -195,15 +637,16 @@ void Executor::assignPriorities() {
 void Executor::stop() {
   auto &instance = Executor::instance();
   instance.running = false;
+  SyncSource *source = instance.activeSyncSource;
+  if (source != nullptr) source->stop();
 #ifdef USE_ETHERCAT
-  if(instance.etherCATStack) instance.etherCATStack->stop();
+  if(instance.syncWithEtherCatStackSet) instance.etherCATStack->stop();
 #endif
 #ifdef USE_ROS2
   rclcpp::shutdown();
   if (instance.subscriberThread != nullptr) {
     instance.subscriberThread->join();
   }
-  instance.handleTopic(); // release lock to stop executor
 #endif
 }
 
@@ -237,32 +680,99 @@ rclcpp::CallbackGroup::SharedPtr Executor::registerSubscriber(rclcpp::Node::Shar
 }
 
 void Executor::handleTopic() {
-  cv.notify_one();
+  rosTopicSync.trigger();
 }
 #endif
 
 void Executor::run() {
+  auto startTime = steady_clock::now();
   log.trace() << "starting executor with base period " << period << " sec and priority " << (int)(basePriority) << " (thread " << getpid() << ":" << syscall(SYS_gettid) << ")";
   if (period == 0.0) throw std::runtime_error("period of executor not set");
+  if (overrunPolicy == OverrunPolicy::safetyEvent && (safetySystem == nullptr || safetyEvent == nullptr))
+    throw std::runtime_error("overrun policy needs a registered safety event");
   log.trace() << "assigning priorities";
   assignPriorities();
+  assignAffinities();
+  std::vector<bool> fixedPhases;
+  for (auto &t: tasks) fixedPhases.push_back(t.getPhase() >= 0);
+  assignPhases();
+  // validating and sorting allocates, so it is done here and never in the cycles of a time domain
+  std::size_t problems = 0;
+  auto prepare = [&problems] (task::Periodic *task) {
+    auto td = dynamic_cast<control::TimeDomain*>(&task->getTask());
+    if (td == nullptr) return;
+    problems += td->validate();
+    td->sortBlocks();
+  };
+  traverse(tasks, prepare);
+  if (mainTask != nullptr) prepare(mainTask);
+  if (problems > 0) log.warn() << "time domains have " << problems << " connection problems, starting anyway";
+  if (schedulabilityCheck != SchedulabilityCheck::off && !checkSchedulability()) {
+    if (schedulabilityCheck == SchedulabilityCheck::refuse) throw std::runtime_error("task set is not schedulable");
+    log.warn() << "task set is not schedulable, starting anyway";
+  }
   Runnable *mainTask = nullptr;
   if (this->mainTask != nullptr) {
     mainTask = &this->mainTask->getTask();
     log.trace() << "setting '" << this->mainTask->getName() << "' as main task";
   }
   std::vector<std::shared_ptr<TaskThread>> threads; // smart pointer used because async objects must not be copied
+  ForkJoinList forks;
   task::HarmonicTaskList taskList;
   task::Periodic executorTask("executor", period, this, true);
   counter.monitors = this->mainTask->monitors;
-  createThreads(log, tasks, executorTask, threads, taskList);
-  using seconds = std::chrono::duration<double, std::chrono::seconds::period>;
-  std::this_thread::sleep_for(seconds(1)); // wait 1 sec to allow threads to be created
+  if (this->mainTask->getResourceAccounting()) counter.setResourceAccounting(true);
+  createThreads(log, tasks, executorTask, threads, forks, taskList);
+  {
+    std::lock_guard<std::mutex> lock(phaseMutex);
+    taskThreads.clear();
+    for (auto &t: threads) taskThreads.push_back({t->periodic, &t->async});
+    phases.clear();
+    std::vector<int> phase;
+    for (std::size_t i = 0; i < tasks.size(); i++) {
+      for (auto &t: threads) {
+        if (t->periodic != &tasks[i]) continue;
+        task::Harmonic *harmonic = taskList.find(t->async);
+        for (auto &f: forks) {
+          if (harmonic == nullptr) harmonic = f->find(t->async);
+        }
+        if (harmonic == nullptr) continue;
+        phases.push_back({t->periodic, &t->async.counter, harmonic, fixedPhases[i]});
+        phase.push_back(harmonic->getPhase());
+      }
+    }
+    phaseTable.set(phase);
+    phaseTable.acquire();
+  }
+  if (simulatedTimeSet) {
+    for (auto &t: threads) t->async.setInline(true);
+  }
+  // wait until all threads have set their affinity and priority and locked their memory
+  for (auto &t: threads) {
+    if (!t->async.waitReady(readyTimeout))
+      log.error() << "thread of '" << t->name << "' not ready after " << readyTimeout << " sec";
+  }
+  for (auto &t: threads) {
+    if (deadlineRuntime(*t->periodic) > 0 && t->periodic->getRealtime() && !t->async.getScheduled()) {
+      std::lock_guard<std::mutex> lock(phaseMutex);
+      phases.clear();
+      taskThreads.clear();
+      throw std::runtime_error("thread of '" + t->name + "' got neither deadline nor realtime scheduling");
+    }
+  }
   if (!set_priority(0))
     log.error() << "could not set realtime priority";
+  if (!affinity.empty() && !set_affinity(affinity))
+    log.error() << "could not set CPU affinity";
+  log.info() << "cpu placement: executor on cpus " << cpuList(get_affinity());
+  for (auto &t: threads)
+    log.info() << "cpu placement: '" << t->name << "' on cpus " << cpuList(t->async.getAffinity())
+               << ", setup took " << t->async.getSetupTime() * 1000 << " ms";
   prefault_stack();
+  Tracer::registerThread();
   if (!lock_memory())
     log.error() << "could not lock memory in RAM";
+  log.info() << "executor ready after " << duration<double, std::milli>(steady_clock::now() - startTime).count() << " ms";
 
 #ifdef USE_ROS2
   // starts spinning ROS2 subscribers in an own thread
@@ -275,104 +785,42 @@ void Executor::run() {
 #endif
   running = true;
 
-#ifdef USE_ETHERCAT
-  if (etherCATStack) {
-    log.trace() << "starting execution synched to etcherCAT stack";
-    if (syncWithRosTimeSet) log.error() << "Can't use both etherCAT and RosTime to sync executor";
-    if (syncWithRosTopicSet) log.error() << "Can't use both etherCAT and RosTopic to sync executor";
-    while (running) {
-      etherCATStack->sync();
-      counter.tick();
-      taskList.run();
-      if (mainTask != nullptr)
-        mainTask->run();
-      counter.tock();
-    }
-  } else
-#else
-#if defined USE_ROS || defined USE_ROS2
-  if (syncWithRosTimeSet) {
-    log.trace() << "starting execution synched to rosTime";
-    if (syncWithEtherCatStackSet) log.error() << "Can't use both RosTime and etherCAT to sync executor";
-    if (syncWithRosTopicSet) log.error() << "Can't use both RosTime and RosTopic to sync executor";
-    uint64_t periodNsec = static_cast<uint64_t>(period * 1.0e9);
-    uint64_t nextCycle = eeros::System::getTimeNs() + periodNsec;
-    while (running) {
-      // spin and wait for next execution time to match ROS time
-      while (eeros::System::getTimeNs() < nextCycle && running) usleep(10);
-      counter.tick();
-      taskList.run();
-      if (mainTask != nullptr)
-        mainTask->run();
-      counter.tock();
-      nextCycle += periodNsec;
+  SyncSource &source = selectSyncSource();
+  source.start(period);
+  activeSyncSource = &source;
+  while (running && source.wait()) {
+    counter.tick();
+    taskList.run();
+    if (mainTask != nullptr)
+      mainTask->run();
+    counter.tock();
+    handleOverrun(source);
+    if (phaseTable.acquire()) {
+      // new phases computed by balancePhases, switching to them does not allocate
+      auto &phase = phaseTable.current();
+      for (std::size_t i = 0; i < phases.size(); i++) phases[i].harmonic->setPhase(phase[i]);
     }
   }
-#endif //(USE_ROS || USE_ROS2)
-#ifdef USE_ROS
-  else if (syncWithRosTopicSet) {
-    log.trace() << "starting execution synched to gazebo";
-    if (syncWithRosTimeSet) log.error() << "Can't use both RosTopic and RosTime to sync executor";
-    if (syncWithEtherCatStackSet) log.error() << "Can't use both RosTopic and etherCAT to sync executor";
-    auto timeOld = ros::Time::now();
-    auto timeNew = ros::Time::now();
-    static bool first = true;
-    while (running) {
-      if (first) {
-        while (timeOld == timeNew  && running) {	// waits for new rosTime beeing published
-          usleep(10);
-          timeNew = ros::Time::now();
-        }
-        first = false;
-        timeOld = timeNew;
-      }
-      while (syncRosCallbackQueue->isEmpty() && running) usleep(10);	//waits for new message;
-      while (timeOld == timeNew  && running) {		// waits for new rosTime beeing published
-        usleep(10);
-        timeNew = ros::Time::now();
-      }
-      timeOld = timeNew;
-      syncRosCallbackQueue->callAvailable();
-      counter.tick();
-      taskList.run();
-      if (mainTask != nullptr)
-        mainTask->run();
-      counter.tock();
-    }
-  } else
-#endif //(USE_ROS)
-#ifdef USE_ROS2
-    else if (syncWithRosTopicSet) {
-      log.trace() << "starting execution synched to gazebo";
-      if (syncWithRosTimeSet) log.error() << "Can't use both RosTopic and RosTime to sync executor";
-      if (syncWithEtherCatStackSet) log.error() << "Can't use both RosTopic and etherCAT to sync executor";
-      while (running) {
-        std::unique_lock<std::mutex> lk(cv_m);
-        cv.wait(lk);
-        counter.tick();
-        taskList.run();
-        if (mainTask != nullptr)
-          mainTask->run();
-        counter.tock();
-      }
-    } else
-#endif //(USE_ROS2)
-  {
-    log.trace() << "starting periodic execution";
-    // use system time as a start and wait for regular intervals
-    auto nextCycle = std::chrono::steady_clock::now() + seconds(period);
-    while (running) {
-      std::this_thread::sleep_until(nextCycle);
-      counter.tick();
-      taskList.run();
-      if (mainTask != nullptr)
-        mainTask->run();
-      counter.tock();
-      nextCycle += seconds(period);
+  activeSyncSource = nullptr;
+
+  if (!phases.empty()) {
+    std::vector<int> k, phase;
+    std::vector<double> load;
+    for (auto &e: phases) {
+      k.push_back(e.harmonic->getDivisor());
+      phase.push_back(e.harmonic->getPhase());
+      load.push_back(e.counter->run.max);
     }
+    auto ticks = tickLoad(k, phase, load);
+    log.info() << "observed worst case tick load " << worst(ticks) * 1000 << " ms, average "
+               << average(ticks) * 1000 << " ms over " << ticks.size() << " ticks";
   }
-#endif //(USE_ETHERCAT)
 
+  {
+    std::lock_guard<std::mutex> lock(phaseMutex);
+    phases.clear();
+    taskThreads.clear();
+  }
   log.trace() << "stopping all threads";
   for (auto &t: threads) t->async.stop();
   log.trace() << "joining all threads";
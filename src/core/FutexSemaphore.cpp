@@ -0,0 +1,59 @@
+#include <eeros/core/FutexSemaphore.hpp>
+#include <chrono>
+#include <cerrno>
+#include <time.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+using namespace eeros;
+
+namespace {
+
+static_assert(sizeof(std::atomic<int>) == sizeof(int), "futex word must be a plain int");
+
+long futex(std::atomic<int> *addr, int op, int val, const struct timespec *timeout = nullptr) {
+  return syscall(SYS_futex, reinterpret_cast<int*>(addr), op, val, timeout, nullptr, 0);
+}
+
+}
+
+FutexSemaphore::FutexSemaphore(int value) : counter(value), waiters(0) { }
+
+bool FutexSemaphore::tryDecrement() {
+  int c = counter.load();
+  while (c > 0) {
+    if (counter.compare_exchange_weak(c, c - 1)) return true;
+  }
+  return false;
+}
+
+void FutexSemaphore::wait() {
+  while (!tryDecrement()) {
+    waiters++;
+    // sleeps only if the counter is still 0, otherwise returns immediately
+    futex(&counter, FUTEX_WAIT_PRIVATE, 0);
+    waiters--;
+  }
+}
+
+bool FutexSemaphore::wait(double timeout_sec) {
+  using clk = std::chrono::steady_clock;
+  auto deadline = clk::now() + std::chrono::duration_cast<clk::duration>(std::chrono::duration<double>(timeout_sec));
+  while (!tryDecrement()) {
+    auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - clk::now()).count();
+    if (remaining <= 0) return false;
+    struct timespec ts;
+    ts.tv_sec = remaining / 1000000000;
+    ts.tv_nsec = remaining % 1000000000;
+    waiters++;
+    futex(&counter, FUTEX_WAIT_PRIVATE, 0, &ts);
+    waiters--;
+  }
+  return true;
+}
+
+void FutexSemaphore::post() {
+  counter++;
+  if (waiters.load() > 0) futex(&counter, FUTEX_WAKE_PRIVATE, 1);
+}
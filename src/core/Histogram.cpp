@@ -0,0 +1,60 @@
+#include <eeros/core/Histogram.hpp>
+
+using namespace eeros;
+
+Histogram::Histogram() {
+  reset();
+}
+
+int Histogram::index(uint64_t ns) {
+  if (ns < static_cast<uint64_t>(subBucketCount)) return static_cast<int>(ns);
+  int msb = 63 - __builtin_clzll(ns);
+  if (msb >= maxValueBits) return bucketCount - 1;
+  int shift = msb - subBucketBits;
+  return (shift + 1) * subBucketCount + static_cast<int>((ns >> shift) - subBucketCount);
+}
+
+uint64_t Histogram::lowerLimit(int index) {
+  if (index < subBucketCount) return index;
+  int shift = index / subBucketCount - 1;
+  return static_cast<uint64_t>(subBucketCount + index % subBucketCount) << shift;
+}
+
+uint64_t Histogram::upperLimit(int index) {
+  if (index < subBucketCount) return index + 1;
+  int shift = index / subBucketCount - 1;
+  return lowerLimit(index) + (static_cast<uint64_t>(1) << shift);
+}
+
+void Histogram::add(double value) {
+  uint64_t ns = (value > 0) ? static_cast<uint64_t>(value * 1e9) : 0;
+  buckets[index(ns)]++;
+  count++;
+}
+
+void Histogram::reset() {
+  buckets.fill(0);
+  count = 0;
+}
+
+double Histogram::percentile(double percent) const {
+  if (count == 0) return 0;
+  uint64_t limit = static_cast<uint64_t>(percent / 100.0 * count + 0.5);
+  if (limit == 0) limit = 1;
+  uint64_t sum = 0;
+  for (int i = 0; i < bucketCount; i++) {
+    sum += buckets[i];
+    if (sum >= limit) return upperLimit(i) * 1e-9;
+  }
+  return upperLimit(bucketCount - 1) * 1e-9;
+}
+
+uint64_t Histogram::getCount() const {
+  return count;
+}
+
+void Histogram::dump(std::ostream &os) const {
+  for (int i = 0; i < bucketCount; i++) {
+    if (buckets[i] > 0) os << lowerLimit(i) * 1e-9 << '\t' << upperLimit(i) * 1e-9 << '\t' << buckets[i] << '\n';
+  }
+}
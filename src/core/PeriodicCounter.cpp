@@ -1,10 +1,24 @@
 #include <eeros/core/PeriodicCounter.hpp>
+#include <eeros/core/Tracer.hpp>
 #include <eeros/logger/Pretty.hpp>
 #include <eeros/logger/StreamLogWriter.hpp>
+#include <cmath>
+#include <time.h>
+#include <sys/resource.h>
 using namespace eeros;
 
+namespace {
+
+double threadCpuTime() {
+  struct timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+}
+
 PeriodicCounter::PeriodicCounter(double period, unsigned logger_category) :
-  reset_after(20), log(logger::Logger::getLogger('P')) {
+  reset_after(20), accounting(false), log(logger::Logger::getLogger('P')) {
     
   setPeriod(period);
   start = clk::now();
@@ -16,23 +30,58 @@ void PeriodicCounter::setPeriod(double period) {
   reset();
 }
 
+double PeriodicCounter::getPeriod() {
+  return counter_period;
+}
+
 void PeriodicCounter::setResetTime(double sec) {
   reset_after = sec;
 }
 
+void PeriodicCounter::setResourceAccounting(bool enable) {
+  accounting = enable;
+}
+
+bool PeriodicCounter::getResourceAccounting() {
+  return accounting;
+}
+
 void PeriodicCounter::addDefaultMonitor(double tolerance) {
   PeriodicCounter::addDefaultMonitor(monitors, counter_period, tolerance);
 }
 
 void PeriodicCounter::tick() {
+  Tracer::begin("cycle");
   last = start;
+  if (accounting) {
+    struct rusage usage;
+    getrusage(RUSAGE_THREAD, &usage);
+    startMinorFaults = usage.ru_minflt;
+    startMajorFaults = usage.ru_majflt;
+    startVoluntarySwitches = usage.ru_nvcsw;
+    startInvoluntarySwitches = usage.ru_nivcsw;
+    startCpu = threadCpuTime();
+  }
   start = clk::now();
 }
 
 void PeriodicCounter::tock() {
   time_point stop = clk::now();
+  double stopCpu = accounting ? threadCpuTime() : 0;
+  Tracer::end("cycle");
   double new_run = std::chrono::duration<double>(stop - start).count();
   run.add(new_run);
+  runHistogram.add(new_run);
+  
+  if (accounting) {
+    cpu.add(stopCpu - startCpu);
+    struct rusage usage;
+    getrusage(RUSAGE_THREAD, &usage);
+    minorFaults += usage.ru_minflt - startMinorFaults;
+    majorFaults += usage.ru_majflt - startMajorFaults;
+    voluntarySwitches += usage.ru_nvcsw - startVoluntarySwitches;
+    involuntarySwitches += usage.ru_nivcsw - startInvoluntarySwitches;
+  }
   
   if (first) {
     first = false;
@@ -44,6 +93,8 @@ void PeriodicCounter::tock() {
   
   period.add(new_period);
   jitter.add(new_jitter);
+  periodHistogram.add(new_period);
+  jitterHistogram.add(std::abs(new_jitter));
   
   for (auto &func: monitors) func(*this, log);
 }
@@ -52,9 +103,31 @@ void PeriodicCounter::reset() {
   period.reset();
   jitter.reset();
   run.reset();
+  periodHistogram.reset();
+  jitterHistogram.reset();
+  runHistogram.reset();
+  missedDeadlines = 0;
+  maxLateness = 0;
+  consecutiveOverruns = 0;
+  maxConsecutiveOverruns = 0;
+  cpu.reset();
+  minorFaults = 0;
+  majorFaults = 0;
+  voluntarySwitches = 0;
+  involuntarySwitches = 0;
   reset_counter = (int)(reset_after / counter_period);
 }
 
+void PeriodicCounter::checkDeadline(double lateness) {
+  if (lateness > 0) {
+    missedDeadlines++;
+    if (lateness > maxLateness) maxLateness = lateness;
+    if (++consecutiveOverruns > maxConsecutiveOverruns) maxConsecutiveOverruns = consecutiveOverruns;
+  } else {
+    consecutiveOverruns = 0;
+  }
+}
+
 void PeriodicCounter:: operator >> (eeros::logger::LogEntry &event) {
   using namespace eeros::logger;
 
@@ -73,13 +146,50 @@ void PeriodicCounter:: operator >> (eeros::logger::LogEntry &event) {
   event << "run   \t";
   l(event, run) << endl;
 
-  event << "count = " << period.count;
+  if (accounting) {
+    event << "cpu   \t";
+    l(event, cpu) << endl;
+  }
+
+  auto p = [](LogEntry &e, Histogram &x) -> decltype(e) {
+    return e << pretty(x.percentile(50)) << "\t" << pretty(x.percentile(99)) << "\t" << pretty(x.percentile(99.9)) << "\t" << pretty(x.percentile(99.99));
+  };
+
+  event << "pctl:\t      p50\t      p99\t    p99.9\t   p99.99" << endl;
+
+  event << "period\t";
+  p(event, periodHistogram) << endl;
+
+  event << "jitter\t";
+  p(event, jitterHistogram) << endl;
+
+  event << "run   \t";
+  p(event, runHistogram) << endl;
+
+  event << "count = " << period.count << endl;
+
+  event << "missed deadlines = " << missedDeadlines << ", max lateness = " << pretty(maxLateness) 
+        << ", max consecutive overruns = " << maxConsecutiveOverruns;
+
+  if (accounting) {
+    event << endl << "page faults = " << minorFaults << " minor, " << majorFaults << " major, context switches = " 
+          << voluntarySwitches << " voluntary, " << involuntarySwitches << " involuntary";
+  }
 }
 
 void PeriodicCounter:: operator >> (eeros::logger::LogEntry &&event) {
   *this >> event;
 }
 
+void PeriodicCounter::dumpHistograms(std::ostream &os) {
+  os << "# period" << '\n';
+  periodHistogram.dump(os);
+  os << "\n\n# jitter" << '\n';
+  jitterHistogram.dump(os);
+  os << "\n\n# run" << '\n';
+  runHistogram.dump(os);
+}
+
 
 void PeriodicCounter::addDefaultMonitor(std::vector<MonitorFunc> &monitors, double period, double tolerance){
   double Tmin = period * (1 - tolerance);
@@ -0,0 +1,11 @@
+#include <eeros/core/PollingSync.hpp>
+
+using namespace eeros;
+
+PollingSync::PollingSync(std::function<bool()> ready, double pollInterval) 
+    : ready(ready), interval(toTimespec(static_cast<int64_t>(pollInterval * NS_PER_SEC))) { }
+
+bool PollingSync::wait() {
+  while (!stopped && !ready()) clock_nanosleep(CLOCK_MONOTONIC, 0, &interval, nullptr);
+  return !stopped;
+}
@@ -0,0 +1,69 @@
+#include <eeros/core/SchedulabilityAnalysis.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+using namespace eeros;
+
+void SchedulabilityAnalysis::add(std::string name, double period, double wcet, int priority, std::vector<int> cpus) {
+  if (period <= 0) throw std::invalid_argument("period of task '" + name + "' must be positive");
+  if (wcet < 0) throw std::invalid_argument("execution time of task '" + name + "' must not be negative");
+  tasks.push_back({name, period, wcet, priority, cpus, 0, 0, false});
+}
+
+void SchedulabilityAnalysis::clear() {
+  tasks.clear();
+}
+
+bool SchedulabilityAnalysis::interferes(const Task &a, const Task &b) {
+  if (a.cpus.empty() || b.cpus.empty()) return true;
+  for (int cpu: a.cpus) {
+    if (std::find(b.cpus.begin(), b.cpus.end(), cpu) != b.cpus.end()) return true;
+  }
+  return false;
+}
+
+bool SchedulabilityAnalysis::analyse() {
+  std::stable_sort(tasks.begin(), tasks.end(), [] (const Task &a, const Task &b) { return a.priority > b.priority; });
+  bool result = true;
+  for (auto &t: tasks) {
+    std::vector<const Task*> higher;
+    t.utilisation = t.wcet / t.period;
+    for (auto &o: tasks) {
+      if (&o != &t && o.priority >= t.priority && interferes(t, o)) {
+        higher.push_back(&o);
+        t.utilisation += o.wcet / o.period;
+      }
+    }
+    // iterate the response time until it converges or exceeds the deadline, 
+    // starting with every interfering task running once
+    double r = t.wcet;
+    for (auto o: higher) r += o->wcet;
+    t.responseTime = std::numeric_limits<double>::infinity();
+    if (t.utilisation <= 1.0) {
+      while (r <= t.period) {
+        double next = t.wcet;
+        for (auto o: higher) next += std::ceil(r / o->period) * o->wcet;
+        if (next == r) {
+          t.responseTime = r;
+          break;
+        }
+        r = next;
+      }
+    }
+    t.schedulable = (t.responseTime <= t.period);
+    result = result && t.schedulable;
+  }
+  return result;
+}
+
+double SchedulabilityAnalysis::getUtilisation() const {
+  double u = 0;
+  for (auto &t: tasks) u += t.wcet / t.period;
+  return u;
+}
+
+const std::vector<SchedulabilityAnalysis::Task>& SchedulabilityAnalysis::getTasks() const {
+  return tasks;
+}
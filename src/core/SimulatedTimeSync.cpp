@@ -0,0 +1,27 @@
+#include <eeros/core/SimulatedTimeSync.hpp>
+#include <eeros/core/System.hpp>
+#include <stdexcept>
+#include <cmath>
+
+using namespace eeros;
+
+SimulatedTimeSync::SimulatedTimeSync(double duration) 
+    : duration(duration), periodNs(0), cycles(0), count(0) {
+  if (duration < 0) throw std::runtime_error("simulation duration must not be negative");
+}
+
+void SimulatedTimeSync::start(double period) {
+  SyncSource::start(period);
+  periodNs = static_cast<uint64_t>(period * NS_PER_SEC);
+  cycles = static_cast<uint64_t>(std::llround(duration / period));
+  count = 0;
+  System::useSimulatedTime();
+}
+
+bool SimulatedTimeSync::wait() {
+  if (stopped || (cycles > 0 && count >= cycles)) return false;
+  System::advanceSimulatedTime(periodNs);
+  System::runSimulatedThreads();
+  count++;
+  return true;
+}
@@ -0,0 +1,46 @@
+#include <eeros/core/SpinBarrier.hpp>
+#include <chrono>
+#include <thread>
+
+using namespace eeros;
+
+namespace {
+
+// a pause takes up to ~140 cycles on recent x86 CPUs, so limit the spinning by time
+constexpr std::chrono::microseconds spinTime(20);
+
+inline void relax() {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  asm volatile("yield");
+#endif
+}
+
+}
+
+SpinBarrier::SpinBarrier(unsigned count) : count(count), waiting(count), generation(0) { }
+
+void SpinBarrier::wait() {
+  unsigned g = generation.load(std::memory_order_acquire);
+  if (waiting.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    // the last thread resets the barrier and releases the others
+    waiting.store(count, std::memory_order_relaxed);
+    generation.fetch_add(1, std::memory_order_release);
+    return;
+  }
+  // spin for a short time before checking the clock, then yield on every check
+  for (unsigned spins = 0; spins < 64; spins++) {
+    if (generation.load(std::memory_order_acquire) != g) return;
+    relax();
+  }
+  auto deadline = std::chrono::steady_clock::now() + spinTime;
+  while (generation.load(std::memory_order_acquire) == g) {
+    if (std::chrono::steady_clock::now() < deadline) relax();
+    else std::this_thread::yield();
+  }
+}
+
+unsigned SpinBarrier::getCount() const {
+  return count;
+}
@@ -0,0 +1,33 @@
+#include <eeros/core/SyncSource.hpp>
+
+using namespace eeros;
+
+SyncSource::~SyncSource() { }
+
+void SyncSource::start(double period) {
+  this->period = period;
+  stopped = false;
+}
+
+void SyncSource::stop() {
+  stopped = true;
+}
+
+double SyncSource::getLateness() {
+  return 0;
+}
+
+void SyncSource::resync() { }
+
+int64_t SyncSource::now(clockid_t clock) {
+  struct timespec ts;
+  clock_gettime(clock, &ts);
+  return static_cast<int64_t>(ts.tv_sec) * NS_PER_SEC + ts.tv_nsec;
+}
+
+struct timespec SyncSource::toTimespec(int64_t ns) {
+  struct timespec ts;
+  ts.tv_sec = ns / NS_PER_SEC;
+  ts.tv_nsec = ns % NS_PER_SEC;
+  return ts;
+}
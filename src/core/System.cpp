@@ -0,0 +1,84 @@
+#include <eeros/core/System.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+using namespace eeros;
+
+namespace {
+std::mutex simMutex;
+std::condition_variable simCv;
+std::map<std::pair<uint64_t, uint64_t>, uint64_t> simWaiting;  // (wake up time, order) -> ticket
+uint64_t simOrder = 0;      // orders threads waiting for the same time
+uint64_t simTickets = 0;
+uint64_t simRunning = 0;    // ticket of the thread which runs, 0 if none
+thread_local uint64_t simTicket = 0;
+
+void waitForTurn(std::unique_lock<std::mutex> &lock, uint64_t ticket) {
+  simCv.wait(lock, [ticket]() { return simRunning == ticket || !System::isSimulatedTime(); });
+}
+}
+
+void System::sleepUntilNs(uint64_t timeNs) {
+  if (simTicket != 0 && isSimulatedTime()) {
+    std::unique_lock<std::mutex> lock(simMutex);
+    simWaiting[{timeNs, ++simOrder}] = simTicket;
+    simRunning = 0;
+    simCv.notify_all();
+    waitForTurn(lock, simTicket);
+    return;
+  }
+  if (isSimulatedTime()) {
+    // not taking part, the simulated time advances without this thread
+    while (isSimulatedTime() && getTimeNs() < timeNs) std::this_thread::sleep_for(std::chrono::microseconds(100));
+    return;
+  }
+  uint64_t now = getTimeNs();
+  if (timeNs > now) std::this_thread::sleep_for(std::chrono::nanoseconds(timeNs - now));
+}
+
+uint64_t System::addSimulatedThread() {
+  std::lock_guard<std::mutex> lock(simMutex);
+  uint64_t ticket = ++simTickets;
+  simWaiting[{getTimeNs(), ++simOrder}] = ticket;
+  return ticket;
+}
+
+void System::enterSimulatedThread(uint64_t ticket) {
+  simTicket = ticket;
+  std::unique_lock<std::mutex> lock(simMutex);
+  waitForTurn(lock, ticket);
+}
+
+void System::leaveSimulatedThread() {
+  if (simTicket == 0) return;
+  std::lock_guard<std::mutex> lock(simMutex);
+  if (simRunning == simTicket) simRunning = 0;
+  simTicket = 0;
+  simCv.notify_all();
+}
+
+bool System::isSimulatedThread() {
+  return simTicket != 0;
+}
+
+void System::runSimulatedThreads() {
+  std::unique_lock<std::mutex> lock(simMutex);
+  uint64_t now = getTimeNs();
+  while (!simWaiting.empty() && simWaiting.begin()->first.first <= now) {
+    simRunning = simWaiting.begin()->second;
+    simWaiting.erase(simWaiting.begin());
+    simCv.notify_all();
+    simCv.wait(lock, []() { return simRunning == 0 || !isSimulatedTime(); });
+  }
+}
+
+void System::releaseSimulatedThreads() {
+  std::lock_guard<std::mutex> lock(simMutex);
+  simWaiting.clear();
+  simRunning = 0;
+  simCv.notify_all();
+}
@@ -1,6 +1,7 @@
 #include <eeros/core/System.hpp>
 #include <eeros/core/Fault.hpp>
 #include <time.h>
+#include <atomic>
 
 #ifdef USE_ROS
 #include <ros/ros.h>
@@ -15,6 +16,11 @@
 
 using namespace eeros;
 
+namespace {
+std::atomic<bool> simulatedTimeIsUsed(false);
+std::atomic<uint64_t> simulatedTime(0);
+}
+
 uint64_t timespec2nsec(struct timespec ts) {
   return static_cast<uint64_t>(ts.tv_sec) * NS_PER_SEC + static_cast<uint64_t>(ts.tv_nsec);
 }
@@ -41,7 +47,27 @@ void System::useRosTime() {
 }
 #endif
 
+void System::useSimulatedTime(uint64_t startNs) {
+  simulatedTime = startNs;
+  simulatedTimeIsUsed = true;
+}
+
+void System::advanceSimulatedTime(uint64_t ns) {
+  simulatedTime += ns;
+}
+
+void System::useRealTime() {
+  simulatedTimeIsUsed = false;
+  releaseSimulatedThreads();
+}
+
+bool System::isSimulatedTime() {
+  return simulatedTimeIsUsed;
+}
+
 uint64_t System::getTimeNs() {
+  if (simulatedTimeIsUsed) return simulatedTime;
+
 #ifdef USE_ROS
   if (rosTimeIsUsed) {
     auto time = ros::Time::now();
@@ -2,6 +2,7 @@
 #include <eeros/core/EEROSException.hpp>
 #include <windows.h>
 #include <chrono>
+#include <atomic>
 
 #ifdef USE_ROS2
 #include <rclcpp/rclcpp.hpp>
@@ -9,6 +10,11 @@
 
 using namespace eeros;
 
+namespace {
+std::atomic<bool> simulatedTimeIsUsed(false);
+std::atomic<uint64_t> simulatedTime(0);
+}
+
 double System::getClockResolution() {
   return 1; // TODO
 }
@@ -33,7 +39,27 @@ double System::getTime() {
   return time;
 }
 
+void System::useSimulatedTime(uint64_t startNs) {
+  simulatedTime = startNs;
+  simulatedTimeIsUsed = true;
+}
+
+void System::advanceSimulatedTime(uint64_t ns) {
+  simulatedTime += ns;
+}
+
+void System::useRealTime() {
+  simulatedTimeIsUsed = false;
+  releaseSimulatedThreads();
+}
+
+bool System::isSimulatedTime() {
+  return simulatedTimeIsUsed;
+}
+
 uint64_t System::getTimeNs() {
+  if (simulatedTimeIsUsed) return simulatedTime;
+
   #ifdef USE_ROS2
   if (rosTimeIsUsed) {
     return rclcpp::Clock(RCL_ROS_TIME).now().nanoseconds();
@@ -1,4 +1,5 @@
 #include <eeros/core/Thread.hpp>
+#include <eeros/core/Executor.hpp>
 #include <sstream>
 #include <sched.h>
 #include <sys/syscall.h>
@@ -6,7 +7,8 @@
 
 using namespace eeros;
 
-Thread::Thread(int priority) : log(logger::Logger::getLogger('T')), t([&,priority]() {
+Thread::Thread(int priority, std::vector<int> affinity) : log(logger::Logger::getLogger('T')), t([&,priority,affinity]() {
+  if (!affinity.empty() && !Executor::set_affinity(affinity)) log.error() << "could not set CPU affinity";
   if (priority != 20) {
     struct sched_param schedulingParam;
     schedulingParam.sched_priority = priority;
@@ -28,6 +30,10 @@ std::string Thread::getId() const {
   return s.str();
 }
 
+std::vector<int> Thread::getAffinity() {
+  return Executor::get_affinity(t.native_handle());
+}
+
 void Thread::join() {
   if(t.joinable()) t.join();
 }
@@ -0,0 +1,59 @@
+#include <eeros/core/TimerFdSync.hpp>
+#include <stdexcept>
+#include <poll.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+using namespace eeros;
+
+TimerFdSync::TimerFdSync(clockid_t clock) : clock(clock), periodNs(0), nextCycle(0), pending(0) {
+  fd = timerfd_create(clock, TFD_CLOEXEC | TFD_NONBLOCK);
+  if (fd < 0) throw std::runtime_error("could not create timerfd");
+}
+
+TimerFdSync::~TimerFdSync() {
+  close(fd);
+}
+
+void TimerFdSync::start(double period) {
+  SyncSource::start(period);
+  periodNs = static_cast<int64_t>(period * NS_PER_SEC);
+  pending = 0;
+  nextCycle = now(clock) + periodNs;
+  struct itimerspec spec;
+  spec.it_interval = toTimespec(periodNs);
+  spec.it_value = toTimespec(nextCycle);
+  if (timerfd_settime(fd, TFD_TIMER_ABSTIME, &spec, nullptr) != 0)
+    throw std::runtime_error("could not start timerfd");
+}
+
+bool TimerFdSync::wait() {
+  while (pending == 0 && !stopped) {
+    struct pollfd p = {fd, POLLIN, 0};
+    uint64_t expirations;
+    if (poll(&p, 1, -1) > 0 && read(fd, &expirations, sizeof(expirations)) == sizeof(expirations)) pending = expirations;
+  }
+  if (pending == 0) return false;
+  pending--;
+  nextCycle += periodNs;
+  return !stopped;
+}
+
+double TimerFdSync::getLateness() {
+  return static_cast<double>(now(clock) - nextCycle) / NS_PER_SEC;
+}
+
+void TimerFdSync::resync() {
+  // the timer keeps its phase, all expirations up to now are dropped
+  int64_t latenessNs = now(clock) - nextCycle;
+  if (latenessNs >= 0) {
+    uint64_t expirations;
+    while (read(fd, &expirations, sizeof(expirations)) == sizeof(expirations));
+    pending = 0;
+    nextCycle += (latenessNs / periodNs + 1) * periodNs;
+  }
+}
+
+int TimerFdSync::getFd() {
+  return fd;
+}
@@ -0,0 +1,150 @@
+#include <eeros/core/Tracer.hpp>
+#include <eeros/core/System.hpp>
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+using namespace eeros;
+
+namespace {
+
+void writeEscaped(std::FILE *file, const char *s) {
+  for (; *s != '\0'; s++) {
+    if (*s == '"' || *s == '\\') std::fputc('\\', file);
+    if (static_cast<unsigned char>(*s) >= 0x20) std::fputc(*s, file);
+  }
+}
+
+}
+
+std::atomic<bool> Tracer::enabled(false);
+thread_local Tracer::ThreadHandle Tracer::handle;
+
+Tracer::Tracer() : file(nullptr), firstEvent(true), writing(false), pid(getpid()) { }
+
+Tracer::~Tracer() {
+  stop();
+}
+
+Tracer& Tracer::instance() {
+  static Tracer tracer;
+  return tracer;
+}
+
+void Tracer::start(const std::string &fileName, double flushPeriod) {
+  std::lock_guard<std::mutex> lock(mtx);
+  if (file != nullptr) throw std::runtime_error("tracer already started");
+  file = std::fopen(fileName.c_str(), "w");
+  if (file == nullptr) throw std::runtime_error("could not open trace file " + fileName);
+  std::fputs("{\"traceEvents\":[\n", file);
+  firstEvent = true;
+  for (auto &b: buffers) b->tail = b->head.load();   // discard old events
+  writing = true;
+  writer = std::thread(&Tracer::writeLoop, this, flushPeriod);
+  enabled = true;
+}
+
+void Tracer::stop() {
+  enabled = false;
+  writing = false;
+  if (writer.joinable()) writer.join();
+  std::lock_guard<std::mutex> lock(mtx);
+  if (file == nullptr) return;
+  flush();
+  std::fprintf(file, "\n],\"otherData\":{\"dropped\":%llu}}\n", static_cast<unsigned long long>(countDropped()));
+  std::fclose(file);
+  file = nullptr;
+  buffers.erase(std::remove_if(buffers.begin(), buffers.end(), [this](const std::unique_ptr<ThreadBuffer> &b) {
+    return std::find(unused.begin(), unused.end(), b.get()) != unused.end();
+  }), buffers.end());
+  unused.clear();
+}
+
+void Tracer::registerThread() {
+  if (isEnabled()) getBuffer();
+}
+
+const char* Tracer::intern(const std::string &name) {
+  auto &t = instance();
+  std::lock_guard<std::mutex> lock(t.mtx);
+  return t.names.insert(name).first->c_str();
+}
+
+uint64_t Tracer::getDropped() {
+  std::lock_guard<std::mutex> lock(mtx);
+  return countDropped();
+}
+
+uint64_t Tracer::countDropped() {
+  uint64_t dropped = 0;
+  for (auto &b: buffers) dropped += b->dropped;
+  return dropped;
+}
+
+Tracer::ThreadBuffer* Tracer::getBuffer() {
+  if (handle.buffer == nullptr) {
+    auto &t = instance();
+    std::lock_guard<std::mutex> lock(t.mtx);
+    if (t.unused.empty()) {
+      t.buffers.emplace_back(new ThreadBuffer());
+      handle.buffer = t.buffers.back().get();
+    } else {
+      handle.buffer = t.unused.back();
+      t.unused.pop_back();
+    }
+    handle.buffer->tid = syscall(SYS_gettid);
+  }
+  return handle.buffer;
+}
+
+Tracer::ThreadHandle::~ThreadHandle() {
+  if (buffer == nullptr) return;
+  auto &t = instance();
+  std::lock_guard<std::mutex> lock(t.mtx);
+  if (t.file != nullptr) t.flush(*buffer);   // keep the last events of the thread
+  else buffer->tail = buffer->head.load();
+  t.unused.push_back(buffer);
+}
+
+void Tracer::record(const char *name, char phase) {
+  ThreadBuffer *b = getBuffer();
+  uint32_t head = b->head.load(std::memory_order_relaxed);
+  if (head - b->tail.load(std::memory_order_acquire) >= bufferSize) {
+    b->dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  Event &e = b->events[head & (bufferSize - 1)];
+  e.time = System::getTimeNs();
+  e.name = name;
+  e.phase = phase;
+  b->head.store(head + 1, std::memory_order_release);
+}
+
+void Tracer::flush() {
+  for (auto &b: buffers) flush(*b);
+}
+
+void Tracer::flush(ThreadBuffer &b) {
+  uint32_t tail = b.tail.load(std::memory_order_relaxed);
+  uint32_t head = b.head.load(std::memory_order_acquire);
+  for (; tail != head; tail++) {
+    const Event &e = b.events[tail & (bufferSize - 1)];
+    std::fprintf(file, "%s{\"name\":\"", firstEvent ? "" : ",\n");
+    writeEscaped(file, e.name);
+    std::fprintf(file, "\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":%d,\"tid\":%ld%s}", 
+                 e.phase, e.time / 1000.0, pid, b.tid, e.phase == 'i' ? ",\"s\":\"t\"" : "");
+    firstEvent = false;
+  }
+  b.tail.store(tail, std::memory_order_release);
+}
+
+void Tracer::writeLoop(double flushPeriod) {
+  auto period = std::chrono::duration<double>(flushPeriod);
+  while (writing) {
+    std::this_thread::sleep_for(period);
+    std::lock_guard<std::mutex> lock(mtx);
+    flush();
+  }
+}
@@ -0,0 +1,17 @@
+#include <eeros/core/TriggerSync.hpp>
+
+using namespace eeros;
+
+bool TriggerSync::wait() {
+  semaphore.wait();
+  return !stopped;
+}
+
+void TriggerSync::stop() {
+  SyncSource::stop();
+  semaphore.post();
+}
+
+void TriggerSync::trigger() {
+  semaphore.post();
+}
@@ -1,5 +1,6 @@
 #include <eeros/safety/SafetySystem.hpp>
 #include <eeros/core/Fault.hpp>
+#include <eeros/core/Tracer.hpp>
 
 namespace eeros {
 	namespace safety {
@@ -79,8 +80,12 @@ namespace eeros {
 		}
 
 		void SafetySystem::run() {
+			Tracer::Span span("safety system");
 			// level must only change before safety system runs or after run method has finished
-			if(nextLevel != nullptr) currentLevel = nextLevel; 
+			if(nextLevel != nullptr && nextLevel != currentLevel) {
+				Tracer::instant(nextLevel->description.c_str());
+				currentLevel = nextLevel;
+			}
 			if(currentLevel != nullptr) {
 
 				// 1) Get currentLevel
@@ -115,7 +120,10 @@ namespace eeros {
 						oa->set();
 					}
 				}
-				if(nextLevel != nullptr) currentLevel = nextLevel; 
+				if(nextLevel != nullptr && nextLevel != currentLevel) {
+					Tracer::instant(nextLevel->description.c_str());
+					currentLevel = nextLevel;
+				}
 			}
 			else {
 				log.error() << "current level is null!";
@@ -1,7 +1,7 @@
 #include <eeros/sequencer/BaseSequence.hpp>
 #include <eeros/sequencer/Sequencer.hpp>
 #include <eeros/core/Fault.hpp>
-#include <unistd.h>
+#include <eeros/core/System.hpp>
 
 namespace eeros {
 namespace sequencer {
@@ -51,7 +51,7 @@ int BaseSequence::action() {
         checkMonitors();    // check monitors of this sequence and all callers, execute exception if necessary
         if (state == SequenceState::restarting) continue; // stop any further actions when restarting
         if (checkExitCondition()) state = SequenceState::terminated;
-        if (state == SequenceState::running) usleep(pollingTime * 1000);  // wait only in case of normal execution
+        if (state == SequenceState::running) sleepPollingTime();  // wait only in case of normal execution
         break;
       }
       case SequenceState::paused: { // not used
@@ -171,6 +171,10 @@ void BaseSequence::setPollingTime(int timeInMilliseconds) {
   pollingTime = timeInMilliseconds;
 }
 
+void BaseSequence::sleepPollingTime() {
+  System::sleepUntilNs(System::getTimeNs() + static_cast<uint64_t>(pollingTime) * 1000000);
+}
+
 void BaseSequence::setTimeoutTime(double timeoutInSec) {
   conditionTimeout.setTimeoutTime(timeoutInSec);
 }
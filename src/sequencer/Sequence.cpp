@@ -1,6 +1,7 @@
 #include <eeros/sequencer/Sequence.hpp>
 #include <eeros/sequencer/Sequencer.hpp>
 #include <eeros/core/Fault.hpp>
+#include <eeros/core/System.hpp>
 #include <unistd.h>
 #include <sys/syscall.h>
 #include <future>
@@ -25,7 +26,8 @@ Sequence::Sequence(std::string name, Sequencer& seq, BaseSequence* caller, bool
   log.trace() << "sequence '" << name << "' created";
 }
 
-int Sequence::run() {	// runs in thread
+int Sequence::run(uint64_t ticket) {	// runs in thread
+  if (ticket != 0) System::enterSimulatedThread(ticket);
   struct sched_param schedulingParam;
   schedulingParam.sched_priority = 0;
   if (sched_setscheduler(0, SCHED_OTHER, &schedulingParam) != 0) log.error() << "could not set scheduling parameter for sequence thread";
@@ -34,9 +36,17 @@ int Sequence::run() {	// runs in thread
   log.trace() << "thread " << getpid() << ":" << syscall(SYS_gettid) << " for sequence '" << name << "' and with priority " << schedulingParam.sched_priority << " started";
   int retVal;
   log.info() << "start thread for sequence '" << name << "' (non-blocking), caller sequence: '" << ((caller != nullptr)?caller->getName():"no caller") << "'";
-  retVal = BaseSequence::action();
+  try {
+    retVal = BaseSequence::action();
+  } catch (...) {
+    finished = true;
+    System::leaveSimulatedThread();
+    throw;
+  }
   log.info() << "sequence '" << name << "' terminated";
   log.trace() << "thread " << getpid() << ":" << syscall(SYS_gettid) << " finished.";
+  finished = true;
+  System::leaveSimulatedThread();
   return retVal;
 }
 
@@ -50,7 +60,10 @@ int Sequence::start() {
     retVal = BaseSequence::action();
     log.info() << "sequence '" << name << "' terminated";
   } else {
-    fut = std::async(std::launch::async, &Sequence::run, this);
+    finished = false;
+    // with simulated time, the thread runs in lockstep with the executor
+    uint64_t ticket = System::isSimulatedTime() ? System::addSimulatedThread() : 0;
+    fut = std::async(std::launch::async, &Sequence::run, this, ticket);
   }
   return retVal;
 }
@@ -60,7 +73,12 @@ int Sequence::getResult() {
 }
 
 void Sequence::wait() {
-  if (fut.valid()) retVal = fut.get();
+  if (!fut.valid()) return;
+  // blocking would stop the simulation, which the sequence waits for
+  if (System::isSimulatedThread()) {
+    while (!finished && System::isSimulatedTime()) sleepPollingTime();
+  }
+  retVal = fut.get();
 }
 
 } // namespace sequencer
@@ -1,21 +1,23 @@
 #include <stdexcept>
+#include <chrono>
 #include <sys/types.h>
 #include <sys/syscall.h>
 #include <unistd.h>
 
 #include <eeros/task/Async.hpp>
 #include <eeros/core/Executor.hpp>
+#include <eeros/core/Tracer.hpp>
 
 using namespace eeros::task;
 using namespace eeros::logger;
 
-Async::Async(Runnable &task, bool realtime , int nice) 
-    : task(task), realtime(realtime), nice(nice), thread(&Async::run_thread, this), 
-      finished(false), log(Logger::getLogger('A')) { }
+Async::Async(Runnable &task, bool realtime , int nice, std::vector<int> affinity, double runtime, double period) 
+    : task(task), realtime(realtime), nice(nice), affinity(affinity), runtime(runtime), period(period), tid(0), synchronous(false), runInline(false), setupTime(0), 
+      scheduled(false), finished(false), log(Logger::getLogger('A')), thread(&Async::run_thread, this) { }
 
-Async::Async(Runnable *task, bool realtime , int nice) 
-    : task(*task), realtime(realtime), nice(nice), thread(&Async::run_thread, this), 
-      finished(false), log(Logger::getLogger('A')) { }
+Async::Async(Runnable *task, bool realtime , int nice, std::vector<int> affinity, double runtime, double period) 
+    : task(*task), realtime(realtime), nice(nice), affinity(affinity), runtime(runtime), period(period), tid(0), synchronous(false), runInline(false), setupTime(0), 
+      scheduled(false), finished(false), log(Logger::getLogger('A')), thread(&Async::run_thread, this) { }
 
 Async::~Async() {
   stop();
@@ -23,6 +25,13 @@ Async::~Async() {
 }
 
 void Async::run() {
+  if (runInline) {
+    counter.tick();
+    task.run();
+    counter.tock();
+    if (synchronous) finishedRun.post();
+    return;
+  }
   semaphore.post();
 }
 
@@ -35,31 +44,91 @@ void Async::join() {
   if (thread.joinable()) thread.join();
 }
 
+void Async::setSynchronous(bool synchronous) {
+  this->synchronous = synchronous;
+}
+
+void Async::setInline(bool runInline) {
+  this->runInline = runInline;
+}
+
+void Async::waitFinished() {
+  finishedRun.wait();
+}
+
+bool Async::waitReady(double timeout_sec) {
+  if (!ready.wait(timeout_sec)) return false;
+  ready.post();   // stays ready for further calls
+  return true;
+}
+
+double Async::getSetupTime() {
+  return setupTime;
+}
+
+pid_t Async::getThreadId() {
+  return tid;
+}
+
+bool Async::getScheduled() {
+  return scheduled;
+}
+
+std::vector<int> Async::getAffinity() {
+  return Executor::get_affinity(thread.native_handle());
+}
+
 void Async::run_thread() {
+  auto start = std::chrono::steady_clock::now();
   const auto pid = getpid();
   const auto tid = syscall(SYS_gettid);
+  this->tid = tid;
+
+  if (!affinity.empty() && !Executor::set_affinity(affinity))
+    log.error() << "could not set CPU affinity of thread " << pid << ":" << tid;
 
   Executor::prefault_stack();
+  Tracer::registerThread();
 
-  if (realtime) {
+  if (realtime && runtime > 0) {
+    log.trace() << "starting deadline thread " << pid << ":" << tid << " with runtime " << runtime * 1e6 
+                << " us every " << period * 1e6 << " us";
+
+    scheduled = Executor::set_deadline(runtime, period, period);
+    if (!scheduled) {
+      log.warn() << "could not set deadline scheduling, falling back to SCHED_FIFO with priority " << Executor::basePriority - nice;
+      scheduled = Executor::set_priority(nice);
+      if (!scheduled) log.error() << "could not set realtime priority";
+    }
+
+    if (!Executor::lock_memory())
+      log.error() << "could not lock memory in RAM";
+  }
+  else if (realtime) {
     int priority = Executor::basePriority - nice;
     log.trace() << "starting realtime thread " << pid << ":" << tid << " with priority " << priority;
 
-    if (!Executor::set_priority(nice))
-      log.error() << "could not set realtime priority";
+    scheduled = Executor::set_priority(nice);
+    if (!scheduled) log.error() << "could not set realtime priority";
 
     if (!Executor::lock_memory())
       log.error() << "could not lock memory in RAM";
   }
   else {
     log.trace() << "starting thread " << pid << ":" << tid;
+    scheduled = true;
   }
 
+  setupTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  ready.post();
+
   semaphore.wait();
   while (!finished) {
     counter.tick();
     task.run();
     counter.tock();
+    if (counter.getPeriod() > 0) counter.checkDeadline(counter.run.last - counter.getPeriod());
+    if (synchronous) finishedRun.post();
     semaphore.wait();
   }
 
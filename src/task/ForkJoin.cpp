@@ -0,0 +1,25 @@
+#include <eeros/task/ForkJoin.hpp>
+
+using namespace eeros::task;
+
+void ForkJoin::add(Async &task, int n, int phase) {
+  task.setSynchronous(true);
+  tasks.push_back({&task, Harmonic(task, n, phase), false});
+}
+
+Harmonic *ForkJoin::find(Runnable &task) {
+  for (auto &t: tasks) {
+    if (t.task == &task) return &t.harmonic;
+  }
+  return nullptr;
+}
+
+void ForkJoin::run() {
+  for (auto &t: tasks) {
+    t.triggered = t.harmonic.tick();
+    if (t.triggered) t.task->run();
+  }
+  for (auto &t: tasks) {
+    if (t.triggered) t.task->waitFinished();
+  }
+}
@@ -1,21 +1,40 @@
 #include <eeros/task/Harmonic.hpp>
+#include <stdexcept>
+#include <string>
 
 using namespace eeros::task;
 
 
-Harmonic::Harmonic(Runnable &task, int n) :
-	n(n), k(0), task(&task) { }
+Harmonic::Harmonic(Runnable &task, int n, int phase) : Harmonic(&task, n, phase) { }
 
-Harmonic::Harmonic(Runnable *task, int n) :
-	n(n), k(0), task(task) { }
+Harmonic::Harmonic(Runnable *task, int n, int phase) : n(n), phase(0), ticks(0), task(task) {
+	if (n < 1) throw std::invalid_argument("divisor " + std::to_string(n) + " must be at least 1");
+	setPhase(phase);
+}
 
 eeros::Runnable * Harmonic::getTask() {
 	return task;
 }
 
+int Harmonic::getDivisor() {
+	return n;
+}
+
+int Harmonic::getPhase() {
+	return phase;
+}
+
+void Harmonic::setPhase(int phase) {
+	if (phase < 0 || phase >= n)
+		throw std::invalid_argument("phase " + std::to_string(phase) + " must be in [0, " + std::to_string(n) + ")");
+	this->phase = phase;
+}
+
+bool Harmonic::tick() {
+	if (++ticks >= n) ticks = 0;
+	return ticks == phase;
+}
+
 void Harmonic::run() {
-	if (++k >= n) {
-		task->run();
-		k = 0;
-	}
+	if (tick()) task->run();
 }
@@ -8,10 +8,17 @@ void HarmonicTaskList::run() {
 		t.run();
 }
 
-void HarmonicTaskList::add(Runnable *t, int n) {
-	tasks.push_back(Harmonic(t, n));
+void HarmonicTaskList::add(Runnable *t, int n, int phase) {
+	tasks.push_back(Harmonic(t, n, phase));
 }
 
-void HarmonicTaskList::add(Runnable &t, int n) {
-	tasks.push_back(Harmonic(t, n));
+void HarmonicTaskList::add(Runnable &t, int n, int phase) {
+	tasks.push_back(Harmonic(t, n, phase));
+}
+
+Harmonic *HarmonicTaskList::find(Runnable &t) {
+	for (auto &h: tasks) {
+		if (h.getTask() == &t) return &h;
+	}
+	return nullptr;
 }
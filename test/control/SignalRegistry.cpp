@@ -0,0 +1,83 @@
+#include <eeros/control/Signal.hpp>
+#include <eeros/control/SignalRegistry.hpp>
+#include <eeros/math/Matrix.hpp>
+#include <gtest/gtest.h>
+#include <memory>
+
+using namespace eeros;
+using namespace eeros::control;
+using namespace eeros::math;
+
+// Test signals are found by id and name as long as they exist
+TEST(controlSignalRegistryTest, findSignal) {
+  auto& registry = SignalRegistry::instance();
+  std::size_t size = registry.size();
+  std::unique_ptr<Signal<>> s1(new Signal<>());
+  Signal<int> s2;
+  EXPECT_EQ(registry.size(), size + 2);
+  s1->setName("axis1/position");
+  EXPECT_EQ(registry.find(s1->getId()), s1.get());
+  EXPECT_EQ(registry.find("axis1/position"), s1.get());
+  s1->setName("axis1/speed");
+  EXPECT_EQ(registry.find("axis1/position"), nullptr);
+  EXPECT_EQ(registry.find("axis1/speed"), s1.get());
+  EXPECT_EQ(Signal<>::getSignalByName("axis1/speed"), s1.get());
+  EXPECT_EQ(Signal<int>::getSignalByName("axis1/speed"), nullptr);
+  EXPECT_EQ(Signal<int>::getSignalById(s2.getId()), &s2);
+  sigid_t id = s1->getId();
+  s1.reset();
+  EXPECT_EQ(registry.find(id), nullptr);
+  EXPECT_EQ(registry.find("axis1/speed"), nullptr);
+  EXPECT_EQ(registry.size(), size + 1);
+}
+
+// Test a copy of a signal keeps the id of the original and is not registered
+TEST(controlSignalRegistryTest, copySignal) {
+  auto& registry = SignalRegistry::instance();
+  Signal<> s1;
+  s1.setName("copied");
+  s1.setValue(1.5);
+  std::size_t size = registry.size();
+  {
+    Signal<> s2(s1);
+    EXPECT_EQ(s1.getId(), s2.getId());
+    EXPECT_EQ(s2.getValue(), 1.5);
+    EXPECT_EQ(registry.size(), size);
+    s2.setName("copy");
+    EXPECT_EQ(registry.find("copy"), nullptr);
+  }
+  EXPECT_EQ(registry.find(s1.getId()), &s1);
+  EXPECT_EQ(registry.find("copied"), &s1);
+}
+
+// Test ids stay unique when more than 65536 signals were created
+TEST(controlSignalRegistryTest, manySignals) {
+  auto& registry = SignalRegistry::instance();
+  Signal<> live;
+  std::size_t size = registry.size();
+  for (int i = 0; i < 70000; i++) {
+    Signal<> s;
+    Signal<> copy(live);
+  }
+  EXPECT_EQ(registry.find(live.getId()), &live);
+  EXPECT_EQ(Signal<>::getSignalById(live.getId()), &live);
+  EXPECT_EQ(registry.size(), size);
+}
+
+// Test type erased access to the value
+TEST(controlSignalRegistryTest, typeErasedAccess) {
+  Signal<> s1;
+  Signal<Matrix<2,1,int>> s2;
+  s1.setValue(2.5);
+  s1.setTimestamp(42);
+  s2.setValue({1, 2});
+  SignalInterface* i1 = SignalRegistry::instance().find(s1.getId());
+  SignalInterface* i2 = SignalRegistry::instance().find(s2.getId());
+  ASSERT_NE(i1, nullptr);
+  ASSERT_NE(i2, nullptr);
+  EXPECT_EQ(i1->getValueString(), "2.5");
+  EXPECT_EQ(i1->getTimestamp(), 42u);
+  EXPECT_TRUE(i1->getType() == typeid(double));
+  EXPECT_TRUE(i2->getType() == typeid(Matrix<2,1,int>));
+  EXPECT_FALSE(i2->getValueString().empty());
+}
@@ -0,0 +1,337 @@
+#include <eeros/control/TimeDomain.hpp>
+#include <eeros/control/Blockio.hpp>
+#include <eeros/control/Constant.hpp>
+#include <eeros/control/Gain.hpp>
+#include <eeros/control/Sum.hpp>
+#include <eeros/control/CycleContext.hpp>
+#include <eeros/task/Lambda.hpp>
+#include <eeros/task/Periodic.hpp>
+#include <eeros/core/Executor.hpp>
+#include <eeros/logger/StreamLogWriter.hpp>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include <chrono>
+
+using namespace eeros;
+using namespace eeros::control;
+
+// Test blocks run after the blocks they read from
+TEST(controlTimeDomainTest, sortBlocks) {
+  logger::Logger::setDefaultStreamLogger(std::cout);
+  std::string order;
+  Blockio<0,1> a([&]() { order += "a"; });
+  Blockio<1,1> b([&]() { order += "b"; });
+  Blockio<2,1> c([&]() { order += "c"; });
+  Blockio<0,1> d([&]() { order += "d"; });
+  b.getIn().connect(a.getOut());
+  c.getIn(0).connect(b.getOut());
+  c.getIn(1).connect(a.getOut());
+  TimeDomain td("td", 0.1, false);
+  td.addBlock(c);
+  td.addBlock(d);
+  td.addBlock(b);
+  td.addBlock(a);
+  EXPECT_EQ(td.sortBlocks(), 0u);
+  td.run();
+  EXPECT_EQ(order, "dabc");
+}
+
+// Test blocks in a loop keep their order
+TEST(controlTimeDomainTest, loop) {
+  std::string order;
+  Blockio<1,1> a([&]() { order += "a"; });
+  Blockio<1,1> b([&]() { order += "b"; });
+  Blockio<1,1> c([&]() { order += "c"; });
+  a.getIn().connect(b.getOut());
+  b.getIn().connect(a.getOut());
+  c.getIn().connect(a.getOut());
+  TimeDomain td("td", 0.1, false);
+  td.addBlock(c);
+  td.addBlock(b);
+  td.addBlock(a);
+  EXPECT_EQ(td.sortBlocks(), 1u);
+  td.run();
+  EXPECT_EQ(order, "bac");
+}
+
+// Test runnables which are not blocks keep their position
+TEST(controlTimeDomainTest, barrier) {
+  std::string order;
+  Blockio<0,1> a([&]() { order += "a"; });
+  Blockio<1,1> b([&]() { order += "b"; });
+  task::Lambda l([&]() { order += "l"; });
+  b.getIn().connect(a.getOut());
+  TimeDomain td("td", 0.1, false);
+  td.addBlock(b);
+  td.addBlock(l);
+  td.addBlock(a);
+  EXPECT_EQ(td.sortBlocks(), 1u);
+  td.run();
+  EXPECT_EQ(order, "bla");
+}
+
+// Test blocks added after sorting run in the order they were added until sorted again
+TEST(controlTimeDomainTest, resortAfterAdd) {
+  std::string order;
+  Blockio<0,1> a([&]() { order += "a"; });
+  Blockio<1,1> b([&]() { order += "b"; });
+  b.getIn().connect(a.getOut());
+  TimeDomain td("td", 0.1, false);
+  td.addBlock(b);
+  td.sortBlocks();
+  td.run();
+  td.addBlock(a);
+  td.run();
+  EXPECT_EQ(order, "bba");
+  td.sortBlocks();
+  order.clear();
+  td.run();
+  EXPECT_EQ(order, "ab");
+}
+
+// Test frozen inputs read the connected signal and are dropped on disconnect
+TEST(controlTimeDomainTest, freeze) {
+  Constant<> c(2.0);
+  Gain<> g(3.0);
+  Gain<> h(1.0);
+  g.getIn().connect(c.getOut());
+  TimeDomain td("td", 0.1, false);
+  td.addBlock(c);
+  td.addBlock(g);
+  td.addBlock(h);
+  EXPECT_FALSE(td.freeze());
+  EXPECT_TRUE(g.getIn().isFrozen());
+  EXPECT_FALSE(h.getIn().isFrozen());
+  EXPECT_TRUE(&g.getIn().getSignalFast() == &c.getOut().getSignal());
+  h.getIn().connect(g.getOut());
+  EXPECT_TRUE(td.freeze());
+  td.sortBlocks();
+  td.start();
+  td.run();
+  EXPECT_EQ(h.getOut().getSignal().getValue(), 6.0);
+  g.getIn().disconnect();
+  EXPECT_FALSE(g.getIn().isFrozen());
+  td.unfreeze();
+  EXPECT_FALSE(h.getIn().isFrozen());
+}
+
+// Test validation reports all unconnected inputs and blocks added twice
+TEST(controlTimeDomainTest, validate) {
+  Constant<> c(2.0);
+  Gain<> g(3.0);
+  Blockio<2,1> b([]() { });
+  b.setName("b");
+  b.getIn(1).connect(c.getOut());
+  TimeDomain td("td", 0.1, false);
+  td.addBlock(c);
+  td.addBlock(g);
+  td.addBlock(b);
+  td.addBlock(c);
+  EXPECT_EQ(td.validate(), 3u);
+  EXPECT_FALSE(td.isValidated());
+  EXPECT_FALSE(b.getIn(0).isFrozen());
+  EXPECT_TRUE(b.getIn(1).isFrozen());
+  td.removeBlock(c);
+  td.addBlock(c);
+  g.getIn().connect(c.getOut());
+  b.getIn(0).connect(g.getOut());
+  EXPECT_EQ(td.validate(), 0u);
+  EXPECT_TRUE(td.isValidated());
+  EXPECT_TRUE(b.getIn(0).isFrozen());
+  td.removeBlock(b);
+  EXPECT_FALSE(td.isValidated());
+}
+
+// Test blocks connected to each other run in different stages
+TEST(controlTimeDomainTest, parallelStages) {
+  logger::Logger::setDefaultStreamLogger(std::cout);
+  Constant<> c(1.0);
+  Gain<> g1(2.0), g2(3.0);
+  Sum<2> s;
+  g1.getIn().connect(c.getOut());
+  g2.getIn().connect(c.getOut());
+  s.getIn(0).connect(g1.getOut());
+  s.getIn(1).connect(g2.getOut());
+  TimeDomain td("td", 0.1, false);
+  td.addBlock(s);
+  td.addBlock(g1);
+  td.addBlock(g2);
+  td.addBlock(c);
+  EXPECT_EQ(td.getStageCount(), 0u);
+  td.setParallel(2);
+  EXPECT_EQ(td.getParallel(), 2u);
+  EXPECT_EQ(td.getStageCount(), 3u);
+  td.start();
+  td.run();
+  EXPECT_EQ(s.getOut().getSignal().getValue(), 5.0);
+  td.setParallel(1);
+  EXPECT_EQ(td.getParallel(), 1u);
+  EXPECT_EQ(td.getStageCount(), 0u);
+}
+
+// Test worker threads are not allowed to share a CPU, realtime ones not to run unpinned
+TEST(controlTimeDomainTest, parallelSharedCpu) {
+  TimeDomain td("td", 0.1, false);
+  EXPECT_THROW(td.setParallel(3, {1}), eeros::Fault);
+  EXPECT_THROW(td.setParallel(3, {1, 1}), eeros::Fault);
+  EXPECT_EQ(td.getParallel(), 1u);
+  TimeDomain rt("rt", 0.1, true);
+  EXPECT_THROW(rt.setParallel(2), eeros::Fault);
+  EXPECT_EQ(rt.getParallel(), 1u);
+  rt.setParallel(1);
+}
+
+// Test parallel runs deliver the same values as sequential runs, also with loops
+TEST(controlTimeDomainTest, parallelDeterministic) {
+  logger::Logger::setDefaultStreamLogger(std::cout);
+  const int axes = 6;
+  struct Axis {
+    Sum<2> err;
+    Gain<> kp{1.0};
+    Sum<2> acc;
+  };
+  auto build = [](TimeDomain &td, Constant<> &c, Axis (&a)[axes]) {
+    for (int k = 0; k < axes; k++) {
+      a[k].kp.setGain(0.1 * (k + 1));
+      a[k].err.negateInput(1);
+      a[k].err.getIn(0).connect(c.getOut());
+      a[k].err.getIn(1).connect(a[k].acc.getOut());
+      a[k].kp.getIn().connect(a[k].err.getOut());
+      a[k].acc.getIn(0).connect(a[k].kp.getOut());
+      a[k].acc.getIn(1).connect(a[k].acc.getOut());
+      a[k].err.getOut().getSignal().setValue(0.0);
+      a[k].kp.getOut().getSignal().setValue(0.0);
+      a[k].acc.getOut().getSignal().setValue(0.0);
+      td.addBlock(a[k].acc);
+      td.addBlock(a[k].kp);
+      td.addBlock(a[k].err);
+    }
+    td.addBlock(c);
+  };
+  Constant<> c1(1.0), c2(1.0);
+  Axis a1[axes], a2[axes];
+  TimeDomain seq("seq", 0.1, false), par("par", 0.1, false);
+  build(seq, c1, a1);
+  build(par, c2, a2);
+  par.setParallel(3);
+  seq.sortBlocks();
+  par.sortBlocks();
+  seq.start();
+  par.start();
+  for (int n = 0; n < 50; n++) {
+    seq.run();
+    par.run();
+    for (int k = 0; k < axes; k++) {
+      ASSERT_EQ(a1[k].acc.getOut().getSignal().getValue(), a2[k].acc.getOut().getSignal().getValue());
+      ASSERT_EQ(a1[k].err.getOut().getSignal().getValue(), a2[k].err.getOut().getSignal().getValue());
+    }
+  }
+  EXPECT_NE(a2[axes - 1].acc.getOut().getSignal().getValue(), 0.0);
+}
+
+// Test a fault thrown on a worker thread is reported by the time domain
+TEST(controlTimeDomainTest, parallelFault) {
+  Constant<> c(1.0);
+  Gain<> g1(2.0), g2(3.0);
+  g1.getIn().connect(c.getOut());
+  TimeDomain td("td", 0.1, false);
+  td.addBlock(c);
+  td.addBlock(g1);
+  td.addBlock(g2);
+  td.setParallel(2);
+  td.sortBlocks();
+  td.start();
+  EXPECT_THROW(td.run(), eeros::Fault);
+}
+
+// Test the profiler ranks blocks by their run time
+TEST(controlTimeDomainTest, profile) {
+  logger::Logger::setDefaultStreamLogger(std::cout);
+  auto spin = [](double time) {
+    auto start = std::chrono::steady_clock::now();
+    while (std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() < time);
+  };
+  Blockio<0,1> a([&]() { spin(10e-6); });
+  Blockio<0,1> b([&]() { spin(200e-6); });
+  Blockio<0,1> c([&]() { });
+  a.setName("a");
+  b.setName("b");
+  c.setName("c");
+  TimeDomain td("td", 0.1, false);
+  td.addBlock(a);
+  td.addBlock(b);
+  td.addBlock(c);
+  td.sortBlocks();
+  td.setProfiling(true);
+  td.start();
+  for (int i = 0; i < 10; i++) td.run();
+  auto ranking = td.getProfile();
+  ASSERT_EQ(ranking.size(), 3u);
+  EXPECT_EQ(ranking[0]->name, "b");
+  EXPECT_EQ(ranking[1]->name, "a");
+  EXPECT_EQ(ranking[2]->name, "c");
+  EXPECT_EQ(ranking[0]->run.count, 10);
+  EXPECT_GE(ranking[0]->run.max, 200e-6);
+  EXPECT_EQ(td.getProfile(true)[0]->name, "b");
+  auto log = logger::Logger::getLogger();
+  td.reportProfile(log, 2);
+  td.resetProfile();
+  EXPECT_EQ(td.getProfile()[0]->run.count, 0);
+}
+
+// Test all blocks of a cycle share its timestamp unless they read the clock
+TEST(controlTimeDomainTest, cycleTime) {
+  logger::Logger::setDefaultStreamLogger(std::cout);
+  Constant<> c1(1.0), c2(2.0), c3(3.0);
+  Gain<> g(2.0);
+  g.getIn().connect(c1.getOut());
+  c3.setAcquisitionTimestamps(true);
+  TimeDomain td("td", 0.1, false);
+  td.addBlock(c1);
+  td.addBlock(g);
+  td.addBlock(c2);
+  td.addBlock(c3);
+  td.sortBlocks();
+  td.start();
+  EXPECT_EQ(td.getCycleTime(), 0u);
+  td.run();
+  timestamp_t t = td.getCycleTime();
+  EXPECT_NE(t, 0u);
+  EXPECT_EQ(c1.getOut().getSignal().getTimestamp(), t);
+  EXPECT_EQ(g.getOut().getSignal().getTimestamp(), t);
+  EXPECT_EQ(c2.getOut().getSignal().getTimestamp(), t);
+  EXPECT_GE(c3.getOut().getSignal().getTimestamp(), t);
+  EXPECT_FALSE(CycleContext::isActive());
+  td.setParallel(2);
+  td.run();
+  EXPECT_GT(td.getCycleTime(), t);
+  t = td.getCycleTime();
+  EXPECT_EQ(c1.getOut().getSignal().getTimestamp(), t);
+  EXPECT_EQ(g.getOut().getSignal().getTimestamp(), t);
+  EXPECT_EQ(c2.getOut().getSignal().getTimestamp(), t);
+}
+
+// Test the executor validates and sorts its time domains and starts with optional inputs left unconnected
+TEST(controlTimeDomainTest, executorValidates) {
+  logger::Logger::setDefaultStreamLogger(std::cout);
+  Constant<> c(2.0);
+  Gain<> g(3.0);
+  Blockio<1,0> b([]() { });   // never reads its input
+  TimeDomain td("td", 0.01, false);
+  td.addBlock(g);
+  td.addBlock(c);
+  td.addBlock(b);
+  int cycles = 0;
+  task::Lambda l([&]() { if (++cycles == 5) Executor::stop(); });
+  task::Periodic mainTask("main", 0.01, l, false);
+  auto &executor = Executor::instance();
+  executor.setMainTask(mainTask);
+  executor.add(td);
+  g.getIn().connect(c.getOut());
+  executor.run();
+  EXPECT_FALSE(td.isValidated());
+  EXPECT_TRUE(g.getIn().isFrozen());
+  EXPECT_FALSE(b.getIn().isFrozen());
+  EXPECT_EQ(g.getOut().getSignal().getValue(), 6.0);
+}
@@ -0,0 +1,141 @@
+#include <eeros/control/Trace.hpp>
+#include <eeros/control/Constant.hpp>
+#include <eeros/control/Signal.hpp>
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <csignal>
+#include <sys/resource.h>
+#include <sys/stat.h>
+
+using namespace eeros;
+using namespace eeros::control;
+
+// Record a signal to a file and read it back
+TEST(controlTraceStreamTest, record) {
+  Constant<> c(0.0);
+  TraceStream<> t(64);
+  t.setName("trace");
+  t.getIn().connect(c.getOut());
+  t.start("traceStreamTest.bin", 0.001, 100);
+  EXPECT_TRUE(t.isRecording());
+  for (int i = 0; i < 1000; i++) {
+    c.getOut().getSignal().setValue(i);
+    c.getOut().getSignal().setTimestamp(i * 100);
+    t.run();
+    if (i % 32 == 0) usleep(2000);
+  }
+  t.stop();
+  EXPECT_FALSE(t.isRecording());
+  EXPECT_EQ(t.getWritten() + t.getDropped(), 1000);
+  std::vector<timestamp_t> time;
+  std::vector<double> value;
+  EXPECT_EQ(TraceStream<>::load("traceStreamTest.bin", time, value), "trace");
+  ASSERT_EQ(time.size(), t.getWritten());
+  ASSERT_EQ(value.size(), t.getWritten());
+  for (std::size_t i = 1; i < value.size(); i++) {
+    EXPECT_GT(value[i], value[i - 1]);
+    EXPECT_EQ(time[i], static_cast<timestamp_t>(value[i] * 100));
+  }
+  std::remove("traceStreamTest.bin");
+}
+
+// Values are not recorded before start and after stop
+TEST(controlTraceStreamTest, startStop) {
+  Constant<> c(1.5);
+  TraceStream<> t(16);
+  t.getIn().connect(c.getOut());
+  c.run();
+  t.run();
+  EXPECT_EQ(t.getWritten(), 0);
+  t.start("traceStreamTest.bin");
+  for (int i = 0; i < 10; i++) t.run();
+  t.stop();
+  t.run();
+  EXPECT_EQ(t.getWritten(), 10);
+  EXPECT_EQ(t.getDropped(), 0);
+  std::vector<timestamp_t> time;
+  std::vector<double> value;
+  TraceStream<>::load("traceStreamTest.bin", time, value);
+  ASSERT_EQ(value.size(), 10);
+  for (auto v : value) EXPECT_EQ(v, 1.5);
+  std::remove("traceStreamTest.bin");
+}
+
+// A full buffer drops records instead of blocking
+TEST(controlTraceStreamTest, dropped) {
+  Constant<> c(1.0);
+  TraceStream<> t(16);
+  t.getIn().connect(c.getOut());
+  t.start("traceStreamTest.bin", 10.0);
+  for (int i = 0; i < 20; i++) t.run();
+  t.stop();
+  EXPECT_EQ(t.getDropped(), 4);
+  EXPECT_EQ(t.getWritten(), 16);
+  std::remove("traceStreamTest.bin");
+}
+
+// Records which could not be written count as dropped
+TEST(controlTraceStreamTest, writeFailed) {
+  Constant<> c(1.0);
+  TraceStream<> t(16);
+  t.getIn().connect(c.getOut());
+  t.start("/dev/full");
+  for (int i = 0; i < 10; i++) t.run();
+  t.stop();
+  EXPECT_EQ(t.getWritten(), 0);
+  EXPECT_EQ(t.getDropped(), 10);
+}
+
+// A partial write stops writing and leaves only complete records in the file
+TEST(controlTraceStreamTest, writePartial) {
+  Constant<> c(1.0);
+  TraceStream<> t(16);
+  t.setName("trace");
+  t.getIn().connect(c.getOut());
+  const std::size_t header = 8 + 3 * sizeof(uint32_t) + 5;
+  rlimit old, limit;
+  getrlimit(RLIMIT_FSIZE, &old);
+  limit = old;
+  limit.rlim_cur = header + 2 * TraceStream<>::recordSize + 3;   // the third record is cut
+  auto handler = std::signal(SIGXFSZ, SIG_IGN);
+  ASSERT_EQ(setrlimit(RLIMIT_FSIZE, &limit), 0);
+  t.start("traceStreamTest.bin", 10.0);
+  for (int i = 0; i < 10; i++) t.run();
+  t.stop();
+  setrlimit(RLIMIT_FSIZE, &old);
+  std::signal(SIGXFSZ, handler);
+  EXPECT_EQ(t.getWritten(), 2);
+  EXPECT_EQ(t.getDropped(), 8);
+  struct stat st;
+  ASSERT_EQ(stat("traceStreamTest.bin", &st), 0);
+  EXPECT_EQ(st.st_size, static_cast<off_t>(header + 2 * TraceStream<>::recordSize));
+  std::vector<timestamp_t> time;
+  std::vector<double> value;
+  EXPECT_EQ(TraceStream<>::load("traceStreamTest.bin", time, value), "trace");
+  EXPECT_EQ(value.size(), 2);
+  std::remove("traceStreamTest.bin");
+}
+
+// Loading a file with a truncated header fails
+TEST(controlTraceStreamTest, loadTruncated) {
+  Constant<> c(1.0);
+  TraceStream<> t(16);
+  t.setName("trace");
+  t.getIn().connect(c.getOut());
+  t.start("traceStreamTest.bin");
+  t.stop();
+  truncate("traceStreamTest.bin", 8 + 3 * sizeof(uint32_t) + 2);
+  std::vector<timestamp_t> time;
+  std::vector<double> value;
+  EXPECT_THROW(TraceStream<>::load("traceStreamTest.bin", time, value), Fault);
+  std::remove("traceStreamTest.bin");
+}
+
+// Loading a file which is no trace fails
+TEST(controlTraceStreamTest, loadInvalid) {
+  std::ofstream("traceStreamTest.bin") << "no trace";
+  std::vector<timestamp_t> time;
+  std::vector<double> value;
+  EXPECT_THROW(TraceStream<>::load("traceStreamTest.bin", time, value), Fault);
+  std::remove("traceStreamTest.bin");
+}
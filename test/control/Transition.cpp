@@ -128,3 +128,56 @@ TEST(controlTransitionSimpleTest, steady) {
   EXPECT_TRUE(Utils::compareApprox(t2.outBlock.getOut().getSignal().getValue(), 1.0, 1e-10));
 }
 
+
+TEST(controlTransitionSimpleTest, averaging) {
+  Transition<> t(0.25);
+  Constant<> c(0);
+  t.inBlock.getIn().connect(c.getOut());
+  t.setAveraging(true);
+  t.outBlock.run();	// nothing received yet
+  EXPECT_TRUE(std::isnan(t.outBlock.getOut().getSignal().getValue()));
+  timestamp_t first = 0, last = 0;
+  for (int i = 1; i <= 4; i++) {
+    c.setValue(i);
+    c.run();
+    if (i == 1) first = c.getOut().getSignal().getTimestamp();
+    last = c.getOut().getSignal().getTimestamp();
+    t.inBlock.run();
+  }
+  t.outBlock.run();
+  EXPECT_TRUE(Utils::compareApprox(t.outBlock.getOut().getSignal().getValue(), 2.5, 1e-10));
+  EXPECT_EQ(t.outBlock.getOut().getSignal().getTimestamp(), first + (last - first) / 2);
+  t.outBlock.run();	// keeps the last value
+  EXPECT_TRUE(Utils::compareApprox(t.outBlock.getOut().getSignal().getValue(), 2.5, 1e-10));
+}
+
+TEST(controlTransitionSimpleTest, decimation) {
+  Transition<> t(0.25);
+  Constant<> c(0);
+  t.inBlock.getIn().connect(c.getOut());
+  t.setDecimation(2);
+  t.setAveraging(true);
+  for (int i = 1; i <= 4; i++) {
+    c.setValue(i);
+    c.run();
+    t.inBlock.run();
+  }
+  t.outBlock.run();	// averages the values 1 and 3
+  EXPECT_TRUE(Utils::compareApprox(t.outBlock.getOut().getSignal().getValue(), 2.0, 1e-10));
+}
+
+TEST(controlTransitionSimpleTest, overrun) {
+  Transition<> t(0.5, false, 4);
+  Constant<> c(0), ref(0);
+  t.inBlock.getIn().connect(c.getOut());
+  t.outBlock.getIn().connect(ref.getOut());
+  for (int i = 1; i <= 6; i++) {
+    c.setValue(i);
+    c.run();
+    t.inBlock.run();
+  }
+  EXPECT_EQ(t.getOverruns(), 2u);
+  ref.run();
+  t.outBlock.run();	// last of the buffered values older than the reference
+  EXPECT_TRUE(Utils::compareApprox(t.outBlock.getOut().getSignal().getValue(), 4.0, 1e-10));
+}
@@ -0,0 +1,72 @@
+#include <eeros/core/FutexSemaphore.hpp>
+
+#include <thread>
+#include <atomic>
+#include <iostream>
+
+using namespace eeros;
+
+int main(int argc, char* argv[]) {
+	std::cout << "Futex semaphore test started" << std::endl;
+	
+	int error = 0, errorSum = 0;
+	int testNo = 1;
+	
+	// ********** TEST 1 **********
+	
+	std::cout << "#" << testNo++ << ": Waiting with timeout" << std::endl;
+	error = 0;
+	{
+		FutexSemaphore s;
+		if (s.wait(0.01)) {
+			std::cout << "  -> Failure: wait on empty semaphore did not time out!" << std::endl;
+			error++;
+		}
+		s.post();
+		if (!s.wait(0.01)) {
+			std::cout << "  -> Failure: wait on posted semaphore timed out!" << std::endl;
+			error++;
+		}
+	}
+	errorSum += error;
+	std::cout << "  -> Test finished with " << error << " error(s)" << std::endl;
+	
+	
+	// ********** TEST 2 **********
+	
+	std::cout << "#" << testNo++ << ": Posting from another thread" << std::endl;
+	error = 0;
+	{
+		const int n = 100000;
+		FutexSemaphore s;
+		std::atomic<int> count(0);
+		std::thread waiter([&]() {
+			for (int i = 0; i < n; i++) {
+				s.wait();
+				count++;
+			}
+		});
+		std::thread poster([&]() {
+			for (int i = 0; i < n; i++) s.post();
+		});
+		poster.join();
+		waiter.join();
+		if (count != n) {
+			std::cout << "  -> Failure: " << count << " of " << n << " posts received!" << std::endl;
+			error++;
+		}
+	}
+	errorSum += error;
+	std::cout << "  -> Test finished with " << error << " error(s)" << std::endl;
+	
+	// ********** END **********
+	
+	if(errorSum == 0) {
+		std::cout << "Futex semaphore test succeeded" << std::endl;
+	}
+	else {
+		std::cout << "Futex semaphore test failed with " << errorSum << " error(s)" << std::endl;
+	}
+	
+	return errorSum;
+}
@@ -0,0 +1,99 @@
+#include <eeros/task/Harmonic.hpp>
+#include <eeros/task/Lambda.hpp>
+
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace eeros;
+
+namespace {
+
+	// returns the calls (counting from 1) in which the task ran
+	std::vector<int> calls(int n, int phase, int count) {
+		std::vector<int> result;
+		int call = 0;
+		task::Lambda l([&]() { result.push_back(call); });
+		task::Harmonic h(l, n, phase);
+		for (call = 1; call <= count; call++) h.run();
+		return result;
+	}
+
+	bool rejects(int n, int phase) {
+		task::Lambda l;
+		try {
+			task::Harmonic h(l, n, phase);
+		}
+		catch (std::invalid_argument &) {
+			return true;
+		}
+		return false;
+	}
+
+}
+
+int main(int argc, char* argv[]) {
+	std::cout << "Harmonic test started" << std::endl;
+	
+	int error = 0, errorSum = 0;
+	int testNo = 1;
+	
+	// ********** TEST 1 **********
+	
+	std::cout << "#" << testNo++ << ": Every phase in [0, n) runs the task every n-th call" << std::endl;
+	error = 0;
+	{
+		std::vector<int> expected[] = {{3, 6, 9}, {1, 4, 7}, {2, 5, 8}};
+		for (int phase = 0; phase < 3; phase++) {
+			if (calls(3, phase, 9) != expected[phase]) {
+				std::cout << "  -> Failure: phase " << phase << " runs the task in the wrong calls!" << std::endl;
+				error++;
+			}
+		}
+		if (calls(1, 0, 3) != std::vector<int>({1, 2, 3})) {
+			std::cout << "  -> Failure: divisor 1 does not run the task in every call!" << std::endl;
+			error++;
+		}
+	}
+	errorSum += error;
+	std::cout << "  -> Test finished with " << error << " error(s)" << std::endl;
+	
+	// ********** TEST 2 **********
+	
+	std::cout << "#" << testNo++ << ": Invalid divisors and phases are rejected" << std::endl;
+	error = 0;
+	{
+		int invalid[][2] = {{0, 0}, {-2, 0}, {3, -1}, {3, 3}, {3, 7}};
+		for (auto &i: invalid) {
+			if (!rejects(i[0], i[1])) {
+				std::cout << "  -> Failure: divisor " << i[0] << " with phase " << i[1] << " accepted!" << std::endl;
+				error++;
+			}
+		}
+		task::Lambda l;
+		task::Harmonic h(l, 4, 1);
+		try {
+			h.setPhase(4);
+			std::cout << "  -> Failure: setPhase accepted a phase equal to the divisor!" << std::endl;
+			error++;
+		}
+		catch (std::invalid_argument &) { }
+		if (h.getPhase() != 1) {
+			std::cout << "  -> Failure: rejected phase changed the phase to " << h.getPhase() << "!" << std::endl;
+			error++;
+		}
+	}
+	errorSum += error;
+	std::cout << "  -> Test finished with " << error << " error(s)" << std::endl;
+	
+	// ********** END **********
+	
+	if(errorSum == 0) {
+		std::cout << "Harmonic test succeeded" << std::endl;
+	}
+	else {
+		std::cout << "Harmonic test failed with " << errorSum << " error(s)" << std::endl;
+	}
+	
+	return errorSum;
+}
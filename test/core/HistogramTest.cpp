@@ -0,0 +1,70 @@
+#include <eeros/core/Histogram.hpp>
+
+#include <cmath>
+#include <iostream>
+
+using namespace eeros;
+
+int main(int argc, char* argv[]) {
+	std::cout << "Histogram test started" << std::endl;
+	
+	int error = 0, errorSum = 0;
+	int testNo = 1;
+	
+	// ********** TEST 1 **********
+	
+	std::cout << "#" << testNo++ << ": Percentiles of uniformly distributed values" << std::endl;
+	error = 0;
+	{
+		Histogram h;
+		for (int i = 1; i <= 10000; i++) h.add(i * 1e-6);
+		double expected[] = {50, 99, 99.9};
+		for (double p : expected) {
+			double value = h.percentile(p);
+			double exact = p / 100.0 * 10000 * 1e-6;
+			if (std::abs(value - exact) / exact > 1.0 / Histogram::subBucketCount) {
+				std::cout << "  -> Failure: p" << p << " is " << value << " instead of " << exact << "!" << std::endl;
+				error++;
+			}
+		}
+		if (h.getCount() != 10000) {
+			std::cout << "  -> Failure: count is " << h.getCount() << "!" << std::endl;
+			error++;
+		}
+	}
+	errorSum += error;
+	std::cout << "  -> Test finished with " << error << " error(s)" << std::endl;
+	
+	
+	// ********** TEST 2 **********
+	
+	std::cout << "#" << testNo++ << ": Values out of range and reset" << std::endl;
+	error = 0;
+	{
+		Histogram h;
+		h.add(-1.0);
+		h.add(1e6);
+		if (h.percentile(50) > 1e-9 || h.percentile(100) < 1000) {
+			std::cout << "  -> Failure: values out of range not clipped!" << std::endl;
+			error++;
+		}
+		h.reset();
+		if (h.getCount() != 0 || h.percentile(99) != 0) {
+			std::cout << "  -> Failure: histogram not empty after reset!" << std::endl;
+			error++;
+		}
+	}
+	errorSum += error;
+	std::cout << "  -> Test finished with " << error << " error(s)" << std::endl;
+	
+	// ********** END **********
+	
+	if(errorSum == 0) {
+		std::cout << "Histogram test succeeded" << std::endl;
+	}
+	else {
+		std::cout << "Histogram test failed with " << errorSum << " error(s)" << std::endl;
+	}
+	
+	return errorSum;
+}
@@ -0,0 +1,103 @@
+#include <eeros/core/ParameterSet.hpp>
+
+#include <thread>
+#include <atomic>
+#include <iostream>
+
+using namespace eeros;
+
+struct Params {
+	int a = 0;
+	int b = 0;
+};
+
+int main(int argc, char* argv[]) {
+	std::cout << "Parameter set test started" << std::endl;
+	
+	int error = 0, errorSum = 0;
+	int testNo = 1;
+	
+	// ********** TEST 1 **********
+	
+	std::cout << "#" << testNo++ << ": Publishing parameters" << std::endl;
+	error = 0;
+	{
+		ParameterSet<Params> ps;
+		if (ps.acquire() || ps.read().a != 0) {
+			std::cout << "  -> Failure: initial parameters not read!" << std::endl;
+			error++;
+		}
+		ps.update([](Params& p) { p.a = 1; });
+		ps.update([](Params& p) { p.b = 2; });
+		if (ps.current().a != 0) {
+			std::cout << "  -> Failure: parameters changed before they were acquired!" << std::endl;
+			error++;
+		}
+		if (!ps.acquire() || ps.current().a != 1 || ps.current().b != 2) {
+			std::cout << "  -> Failure: latest parameters not acquired!" << std::endl;
+			error++;
+		}
+		if (ps.acquire()) {
+			std::cout << "  -> Failure: parameters acquired twice!" << std::endl;
+			error++;
+		}
+		ps.set(Params{5, 6});
+		if (ps.get().a != 5 || ps.read().b != 6) {
+			std::cout << "  -> Failure: replaced parameters not read!" << std::endl;
+			error++;
+		}
+	}
+	errorSum += error;
+	std::cout << "  -> Test finished with " << error << " error(s)" << std::endl;
+	
+	
+	// ********** TEST 2 **********
+	
+	std::cout << "#" << testNo++ << ": Reading while other threads write" << std::endl;
+	error = 0;
+	{
+		const int n = 100000;
+		ParameterSet<Params> ps;
+		std::atomic<bool> done(false);
+		int torn = 0, last = 0, backwards = 0;
+		std::thread reader([&]() {
+			while (!done) {
+				const Params& p = ps.read();
+				if (p.b != -p.a) torn++;
+				if (p.a < last) backwards++;
+				last = p.a;
+			}
+		});
+		auto write = [&]() {
+			for (int i = 0; i < n; i++) {
+				ps.update([](Params& p) { p.a++; p.b = -p.a; });
+			}
+		};
+		std::thread w1(write), w2(write);
+		w1.join();
+		w2.join();
+		done = true;
+		reader.join();
+		if (torn != 0 || backwards != 0) {
+			std::cout << "  -> Failure: " << torn << " torn and " << backwards << " outdated snapshots read!" << std::endl;
+			error++;
+		}
+		if (ps.read().a != 2 * n) {
+			std::cout << "  -> Failure: " << ps.current().a << " of " << 2 * n << " updates received!" << std::endl;
+			error++;
+		}
+	}
+	errorSum += error;
+	std::cout << "  -> Test finished with " << error << " error(s)" << std::endl;
+	
+	// ********** END **********
+	
+	if(errorSum == 0) {
+		std::cout << "Parameter set test succeeded" << std::endl;
+	}
+	else {
+		std::cout << "Parameter set test failed with " << errorSum << " error(s)" << std::endl;
+	}
+	
+	return errorSum;
+}
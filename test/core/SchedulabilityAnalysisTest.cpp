@@ -0,0 +1,91 @@
+#include <eeros/core/SchedulabilityAnalysis.hpp>
+
+#include <cmath>
+#include <iostream>
+
+using namespace eeros;
+
+int main(int argc, char* argv[]) {
+	std::cout << "Schedulability analysis test started" << std::endl;
+	
+	int error = 0, errorSum = 0;
+	int testNo = 1;
+	
+	// ********** TEST 1 **********
+	
+	std::cout << "#" << testNo++ << ": Response times of a schedulable task set" << std::endl;
+	error = 0;
+	{
+		// textbook example: (T=7, C=3), (T=12, C=3), (T=20, C=5) -> R = 3, 6, 20
+		SchedulabilityAnalysis a;
+		a.add("low", 20, 5, 1);
+		a.add("high", 7, 3, 3);
+		a.add("mid", 12, 3, 2);
+		if (!a.analyse()) {
+			std::cout << "  -> Failure: task set not schedulable!" << std::endl;
+			error++;
+		}
+		double expected[] = {3, 6, 20};
+		for (int i = 0; i < 3; i++) {
+			if (std::abs(a.getTasks()[i].responseTime - expected[i]) > 1e-12) {
+				std::cout << "  -> Failure: response time of '" << a.getTasks()[i].name << "' is " << a.getTasks()[i].responseTime << " instead of " << expected[i] << "!" << std::endl;
+				error++;
+			}
+		}
+		if (std::abs(a.getUtilisation() - (3.0 / 7 + 3.0 / 12 + 5.0 / 20)) > 1e-12) {
+			std::cout << "  -> Failure: utilisation is " << a.getUtilisation() << "!" << std::endl;
+			error++;
+		}
+	}
+	errorSum += error;
+	std::cout << "  -> Test finished with " << error << " error(s)" << std::endl;
+	
+	
+	// ********** TEST 2 **********
+	
+	std::cout << "#" << testNo++ << ": Missed deadline" << std::endl;
+	error = 0;
+	{
+		SchedulabilityAnalysis a;
+		a.add("high", 0.001, 0.0006, 2);
+		a.add("low", 0.002, 0.0009, 1);
+		if (a.analyse()) {
+			std::cout << "  -> Failure: overloaded task set reported as schedulable!" << std::endl;
+			error++;
+		}
+		if (!a.getTasks()[0].schedulable || a.getTasks()[1].schedulable) {
+			std::cout << "  -> Failure: wrong task reported as unschedulable!" << std::endl;
+			error++;
+		}
+	}
+	errorSum += error;
+	std::cout << "  -> Test finished with " << error << " error(s)" << std::endl;
+	
+	
+	// ********** TEST 3 **********
+	
+	std::cout << "#" << testNo++ << ": Tasks on disjoint CPUs do not interfere" << std::endl;
+	error = 0;
+	{
+		SchedulabilityAnalysis a;
+		a.add("high", 0.001, 0.0006, 2, {0});
+		a.add("low", 0.002, 0.0009, 1, {1});
+		if (!a.analyse() || std::abs(a.getTasks()[1].responseTime - 0.0009) > 1e-12) {
+			std::cout << "  -> Failure: tasks on different CPUs interfere!" << std::endl;
+			error++;
+		}
+	}
+	errorSum += error;
+	std::cout << "  -> Test finished with " << error << " error(s)" << std::endl;
+	
+	// ********** END **********
+	
+	if(errorSum == 0) {
+		std::cout << "Schedulability analysis test succeeded" << std::endl;
+	}
+	else {
+		std::cout << "Schedulability analysis test failed with " << errorSum << " error(s)" << std::endl;
+	}
+	
+	return errorSum;
+}
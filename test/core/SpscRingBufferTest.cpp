@@ -0,0 +1,93 @@
+#include <eeros/core/SpscRingBuffer.hpp>
+
+#include <thread>
+#include <iostream>
+
+using namespace eeros;
+
+int main(int argc, char* argv[]) {
+	std::cout << "SPSC ring buffer test started" << std::endl;
+	
+	int error = 0, errorSum = 0;
+	int testNo = 1;
+	
+	// ********** TEST 1 **********
+	
+	std::cout << "#" << testNo++ << ": Filling and emptying" << std::endl;
+	error = 0;
+	{
+		SpscRingBuffer<int> rb(3);
+		int v;
+		if (rb.size() != 4) {
+			std::cout << "  -> Failure: capacity " << rb.size() << " not rounded up to 4!" << std::endl;
+			error++;
+		}
+		if (rb.pop(v)) {
+			std::cout << "  -> Failure: pop from empty buffer succeeded!" << std::endl;
+			error++;
+		}
+		for (int i = 0; i < 4; i++) rb.push(i);
+		if (rb.push(4) || rb.length() != 4) {
+			std::cout << "  -> Failure: push to full buffer succeeded!" << std::endl;
+			error++;
+		}
+		for (int i = 0; i < 4; i++) {
+			if (!rb.pop(v) || v != i) {
+				std::cout << "  -> Failure: item " << i << " not popped in order!" << std::endl;
+				error++;
+			}
+		}
+		if (rb.length() != 0) {
+			std::cout << "  -> Failure: buffer not empty!" << std::endl;
+			error++;
+		}
+	}
+	errorSum += error;
+	std::cout << "  -> Test finished with " << error << " error(s)" << std::endl;
+	
+	
+	// ********** TEST 2 **********
+	
+	std::cout << "#" << testNo++ << ": Passing items to another thread" << std::endl;
+	error = 0;
+	{
+		const int n = 100000;
+		SpscRingBuffer<int> rb(16);
+		int wrong = 0;
+		std::thread consumer([&]() {
+			int v, expected = 0;
+			while (expected < n) {
+				if (rb.pop(v)) {
+					if (v != expected) wrong++;
+					expected++;
+				} else {
+					std::this_thread::yield();
+				}
+			}
+		});
+		std::thread producer([&]() {
+			for (int i = 0; i < n; i++) {
+				while (!rb.push(i)) std::this_thread::yield();
+			}
+		});
+		producer.join();
+		consumer.join();
+		if (wrong != 0) {
+			std::cout << "  -> Failure: " << wrong << " of " << n << " items received out of order!" << std::endl;
+			error++;
+		}
+	}
+	errorSum += error;
+	std::cout << "  -> Test finished with " << error << " error(s)" << std::endl;
+	
+	// ********** END **********
+	
+	if(errorSum == 0) {
+		std::cout << "SPSC ring buffer test succeeded" << std::endl;
+	}
+	else {
+		std::cout << "SPSC ring buffer test failed with " << errorSum << " error(s)" << std::endl;
+	}
+	
+	return errorSum;
+}
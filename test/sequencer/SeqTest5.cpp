@@ -0,0 +1,76 @@
+#include <eeros/sequencer/Sequencer.hpp>
+#include <eeros/sequencer/Sequence.hpp>
+#include <eeros/sequencer/Wait.hpp>
+#include <eeros/core/SimulatedTimeSync.hpp>
+#include <eeros/core/System.hpp>
+
+#include <gtest/gtest.h>
+
+namespace seqTest5 {
+using namespace eeros;
+using namespace eeros::sequencer;
+std::vector<std::string> record;
+int plant = 0;    // advanced once per cycle, like a control system
+
+void note(std::string tag) {
+  record.push_back(tag + " " + std::to_string(System::getTimeNs()) + " " + std::to_string(plant));
+}
+
+class ChildSequence : public Sequence {
+ public:
+  ChildSequence(std::string name, Sequence* caller) : Sequence(name, caller, false), sleep("sleep", this) { }
+  int action() {
+    for (int i = 0; i < 3; i++) {
+      sleep(0.25);
+      note("child");
+    }
+    return 0;
+  }
+  Wait sleep;
+};
+
+class MainSequence : public Sequence {
+ public:
+  MainSequence(std::string name, Sequencer& seq) : Sequence(name, seq), sleep("sleep", this), child("child", this) { }
+  int action() {
+    child();
+    for (int i = 0; i < 4; i++) {
+      sleep(0.3);
+      note("main");
+    }
+    child.wait();
+    note("end");
+    return 0;
+  }
+  Wait sleep;
+  ChildSequence child;
+};
+
+std::vector<std::string> replay() {
+  record.clear();
+  plant = 0;
+  auto& sequencer = Sequencer::instance();
+  sequencer.clearList();
+  SimulatedTimeSync sync;
+  sync.start(0.001);
+  MainSequence mainSeq("Main Sequence", sequencer);
+  mainSeq();
+  while (sync.wait() && System::getTimeNs() < 2000000000) plant++;
+  sequencer.wait();
+  System::useRealTime();
+  return record;
+}
+
+// Test sequences run in lockstep with simulated time and replay identically
+TEST(seqTest5, simulatedReplay) {
+  auto first = replay();
+  auto second = replay();
+  EXPECT_EQ(first, second);
+  ASSERT_EQ(first.size(), 8);
+  // waits are checked with the polling time of 100ms
+  EXPECT_EQ(first.front(), "child 301000000 300");
+  EXPECT_EQ(first[1], "main 401000000 400");
+  EXPECT_EQ(first.back(), "end 1601000000 1600");
+}
+
+}